@@ -23,29 +23,37 @@
 
 NTPClient::NTPClient(UDP& udp) {
   this->_udp            = &udp;
+  this->_servers[0].name = "pool.ntp.org"; // Default time server
 }
 
 NTPClient::NTPClient(UDP& udp, int timeOffset) {
   this->_udp            = &udp;
   this->_timeOffset     = timeOffset;
+  this->_servers[0].name = "pool.ntp.org";
 }
 
 NTPClient::NTPClient(UDP& udp, const char* poolServerName) {
   this->_udp            = &udp;
-  this->_poolServerName = poolServerName;
+  this->_servers[0].name = poolServerName;
 }
 
 NTPClient::NTPClient(UDP& udp, const char* poolServerName, int timeOffset) {
   this->_udp            = &udp;
   this->_timeOffset     = timeOffset;
-  this->_poolServerName = poolServerName;
+  this->_servers[0].name = poolServerName;
 }
 
 NTPClient::NTPClient(UDP& udp, const char* poolServerName, int timeOffset, unsigned long updateInterval) {
   this->_udp            = &udp;
   this->_timeOffset     = timeOffset;
-  this->_poolServerName = poolServerName;
-  this->_updateInterval = updateInterval;
+  this->_servers[0].name = poolServerName;
+  this->setUpdateInterval(updateInterval);
+}
+
+NTPClient::NTPClient(UDP& udp, const char* const* poolServerNames, uint8_t count, int timeOffset) {
+  this->_udp            = &udp;
+  this->_timeOffset     = timeOffset;
+  this->setPoolServers(poolServerNames, count);
 }
 
 void NTPClient::begin() {
@@ -78,22 +86,50 @@ bool NTPClient::isValid(byte * ntpPacket)
 	if(	ntpPacket[16] == 0 && ntpPacket[17] == 0 && 
 		ntpPacket[18] == 0 && ntpPacket[19] == 0 &&
 		ntpPacket[20] == 0 && ntpPacket[21] == 0 &&
-		ntpPacket[22] == 0 && ntpPacket[22] == 0)		//Check for ReferenceTimestamp != 0
+		ntpPacket[22] == 0 && ntpPacket[23] == 0)		//Check for ReferenceTimestamp != 0
+		return false;
+
+	if(	ntpPacket[40] == 0 && ntpPacket[41] == 0 &&
+		ntpPacket[42] == 0 && ntpPacket[43] == 0)		//Check for TransmitTimestamp != 0
+		return false;
+
+	if(!this->_pending || memcmp(ntpPacket + 24, this->_originate, 8) != 0)	//Check for OriginateTimestamp == our request
 		return false;
 
 	return true;
 }
 
-bool NTPClient::forceUpdate() {
+uint64_t NTPClient::ntpToEpoch(uint32_t secsSince1900) {
+  uint64_t secs = secsSince1900;
+  if (secsSince1900 < NTP_ERA_PIVOT)
+    secs += 0x100000000ULL;   // era 1
+  return secs - SEVENZYYEARS;
+}
+
+// Lower is better: round trip and its variation, penalty for every missed poll
+uint16_t NTPClient::score(uint8_t server) {
+  const NTPServer& stats = this->_servers[server];
+  if (stats.polls == 0) return NTP_UNKNOWN_SCORE;
+  uint8_t missed = stats.polls;
+  for (uint8_t reach = stats.reach; reach; reach >>= 1)
+    missed -= reach & 1;
+  return stats.delay + 2 * stats.jitter + missed * 250;
+}
+
+bool NTPClient::query(uint8_t server) {
+  NTPServer& stats = this->_servers[server];
   #ifdef DEBUG_NTPClient
-    Serial.println("Update from NTP Server");
+    Serial.print("Update from NTP Server ");
+    Serial.println(stats.name);
   #endif
   // flush any existing packets
   while(this->_udp->parsePacket() != 0)
     this->_udp->flush();
-  this->sendNTPPacket();
+  this->sendNTPPacket(stats.name);
+  unsigned long sent = millis();
 
   // Wait till data is there or timeout...
+  // (packets not answering our request are dropped, the request is not sent again)
   byte timeout = 0;
   int cb = 0;
   do {
@@ -102,38 +138,169 @@ bool NTPClient::forceUpdate() {
     
     if(cb > 0)
     {
-      this->_udp->read(this->_packetBuffer, NTP_PACKET_SIZE);
-      if(!this->isValid(this->_packetBuffer))
+      if(cb < NTP_PACKET_SIZE || this->_udp->read(this->_packetBuffer, NTP_PACKET_SIZE) != NTP_PACKET_SIZE || !this->isValid(this->_packetBuffer))
         cb = 0;
+      this->_udp->flush();
     }
     
-    if (timeout > 100) return false; // timeout after 1000 ms
+    if (cb == 0 && timeout > 100) { // timeout after 1000 ms
+      this->_pending = false;
+      stats.reach <<= 1;
+      if (stats.polls < 8) stats.polls++;
+      return false;
+    }
     timeout++;
   } while (cb == 0);
-
-  this->_lastUpdate = millis() - (10 * (timeout + 1)); // Account for delay in reading the time
+  this->_pending = false; // only one answer is accepted
+
+  unsigned long received = millis();
+  unsigned long roundTrip = received - sent;
+
+  // reachability, smoothed delay and jitter (first sample is taken as it is)
+  if (stats.reach == 0) {
+    stats.delay = roundTrip;
+    stats.jitter = 0;
+  } else {
+    long change = (long)roundTrip - stats.delay;
+    stats.delay += change / 4;
+    stats.jitter += ((change < 0 ? -change : change) - stats.jitter) / 4;
+  }
+  stats.reach = (stats.reach << 1) | 1;
+  if (stats.polls < 8) stats.polls++;
 
   unsigned long highWord = word(this->_packetBuffer[40], this->_packetBuffer[41]);
   unsigned long lowWord = word(this->_packetBuffer[42], this->_packetBuffer[43]);
   // combine the four bytes (two words) into a long integer
   // this is NTP time (seconds since Jan 1 1900):
   unsigned long secsSince1900 = highWord << 16 | lowWord;
+  unsigned long highFraction = word(this->_packetBuffer[44], this->_packetBuffer[45]);
+  unsigned long lowFraction = word(this->_packetBuffer[46], this->_packetBuffer[47]);
+  unsigned long fraction = highFraction << 16 | lowFraction;
+
+  // the answer was sent about half of the round trip ago
+  unsigned long ms = (((uint64_t)fraction * 1000) >> 32) + roundTrip / 2;
+  uint64_t epoc = ntpToEpoch(secsSince1900) + ms / 1000;
+  unsigned long lastUpdate = received - ms % 1000;
+
+  // poll less often while the clock keeps up, often again when it does not
+  if (this->_timeSet) {
+    long predicted = (long)(received - this->_lastUpdate) + (long)(this->_currentEpoc - epoc) * 1000;
+    long offset = (long)(received - lastUpdate) - predicted;
+    if (offset < 0) offset = -offset;
+    if (offset < NTP_STABLE_OFFSET)
+      this->_updateInterval = min(this->_updateInterval * 2, this->_maxInterval);
+    else if (offset > NTP_STEP_OFFSET)
+      this->_updateInterval = this->_minInterval;
+  }
 
-  this->_currentEpoc = secsSince1900 - SEVENZYYEARS;
-
+  this->_currentEpoc = epoc;
+  this->_lastUpdate = lastUpdate;
+  this->_timeSet = true;
+  this->_server = server;
+  this->_retryInterval = 0;
   return true;
 }
 
+bool NTPClient::forceUpdate() {
+  this->_lastAttempt = millis();
+
+  // keep statistics of other servers fresh, so a better one can be found
+  bool tried[NTP_MAX_SERVERS] = {false};
+  if (this->_serverCount > 1 && ++this->_polls % NTP_PROBE_EVERY == 0) {
+    this->_probe = (this->_probe + 1) % this->_serverCount;
+    if (this->_probe == this->_server) this->_probe = (this->_probe + 1) % this->_serverCount;
+    uint8_t server = this->_server;
+    bool probed = this->query(this->_probe);
+    if (probed && this->score(this->_probe) < this->score(server)) return true;  // already synced from the better one
+    this->_server = server;
+  }
+
+  // try servers from the best one
+  for (uint8_t attempt = 0; attempt < this->_serverCount; attempt++) {
+    uint8_t best = 0;
+    uint16_t bestScore = 0xFFFF;
+    for (uint8_t i = 0; i < this->_serverCount; i++) {
+      if (tried[i]) continue;
+      uint16_t current = this->score(i);
+      if (current < bestScore) {
+        best = i;
+        bestScore = current;
+      }
+    }
+    tried[best] = true;
+    if (this->query(best)) return true;
+  }
+
+  // no server answered, try again soon (backing off, so an unreachable network does not block every loop)
+  this->_updateInterval = this->_minInterval;
+  this->_retryInterval = this->_retryInterval ? min(this->_retryInterval * 2, this->_updateInterval) : min(NTP_RETRY_INTERVAL, this->_updateInterval);
+  return false;
+}
+
+unsigned long NTPClient::nextInterval() {
+  return this->_retryInterval ? this->_retryInterval : this->_updateInterval;
+}
+
+bool NTPClient::isUpdateDue() {
+  return (!this->_timeSet && !this->_retryInterval)                 // Update if there was no attempt yet.
+      || millis() - this->_lastAttempt >= this->nextInterval();     // Update after _updateInterval (or retry)
+}
+
+bool NTPClient::isTimeSet() {
+  return this->_timeSet;
+}
+
+unsigned long NTPClient::getUpdateDueIn() {
+  if (this->isUpdateDue()) return 0;
+  return this->nextInterval() - (millis() - this->_lastAttempt);
+}
+
 bool NTPClient::update() {
-  if ((millis() - this->_lastUpdate >= this->_updateInterval)     // Update after _updateInterval
-    || this->_lastUpdate == 0) {                                // Update if there was no update yet.
+  if (this->isUpdateDue()) {
     if (!this->_udpSetup) this->begin();                         // setup the UDP client if needed
     return this->forceUpdate();
   }
   return true;
 }
 
+void NTPClient::setPoolServers(const char* const* poolServerNames, uint8_t count) {
+  if (count > NTP_MAX_SERVERS) count = NTP_MAX_SERVERS;
+  if (count == 0) return;
+  for (uint8_t i = 0; i < count; i++) {
+    this->_servers[i] = NTPServer();
+    this->_servers[i].name = poolServerNames[i];
+  }
+  this->_serverCount = count;
+  this->_server = 0;
+  this->_updateInterval = this->_minInterval;
+  this->_retryInterval = 0;
+}
+
+const NTPServer& NTPClient::getServer() {
+  return this->_servers[this->_server];
+}
+
+const NTPServer& NTPClient::getServer(uint8_t index) {
+  return this->_servers[index < this->_serverCount ? index : 0];
+}
+
+uint8_t NTPClient::getServerCount() {
+  return this->_serverCount;
+}
+
+uint8_t NTPClient::getServerIndex() {
+  return this->_server;
+}
+
+unsigned long NTPClient::getUpdateInterval() {
+  return this->_updateInterval;
+}
+
 unsigned long NTPClient::getEpochTime() {
+  return (unsigned long)this->getEpochTime64();
+}
+
+uint64_t NTPClient::getEpochTime64() {
   return this->_timeOffset + // User offset
          this->_currentEpoc + // Epoc returned by the NTP server
          ((millis() - this->_lastUpdate) / 1000); // Time since last update
@@ -205,9 +372,11 @@ void NTPClient::setTimeOffset(int timeOffset) {
 
 void NTPClient::setUpdateInterval(unsigned long updateInterval) {
   this->_updateInterval = updateInterval;
+  this->_minInterval    = updateInterval;
+  if (this->_maxInterval < updateInterval) this->_maxInterval = updateInterval;
 }
 
-void NTPClient::sendNTPPacket() {
+void NTPClient::sendNTPPacket(const char* server) {
   // set all bytes in the buffer to 0
   memset(this->_packetBuffer, 0, NTP_PACKET_SIZE);
   // Initialize values needed to form NTP request
@@ -222,9 +391,20 @@ void NTPClient::sendNTPPacket() {
   this->_packetBuffer[14]  = 0x49;
   this->_packetBuffer[15]  = 0x52;
 
+  // Transmit timestamp - current time with random fraction, the answer has to
+  // carry it back as originate timestamp (rejects stale and spoofed answers)
+  uint32_t secs = this->_timeSet ? (uint32_t)(this->getEpochTime64() - this->_timeOffset + SEVENZYYEARS) : 0;
+  uint32_t fraction = random(0x7FFFFFFF) ^ ((uint32_t)random(0x7FFFFFFF) << 1);
+  for (uint8_t i = 0; i < 4; i++) {
+    this->_packetBuffer[40 + i] = secs >> (24 - 8 * i);
+    this->_packetBuffer[44 + i] = fraction >> (24 - 8 * i);
+  }
+  memcpy(this->_originate, this->_packetBuffer + 40, 8);
+  this->_pending = true;
+
   // all NTP fields have been given values, now
   // you can send a packet requesting a timestamp:
-  this->_udp->beginPacket(this->_poolServerName, 123); //NTP requests are to port 123
+  this->_udp->beginPacket(server, 123); //NTP requests are to port 123
   this->_udp->write(this->_packetBuffer, NTP_PACKET_SIZE);
   this->_udp->endPacket();
 }
@@ -4,30 +4,60 @@
 
 #include <Udp.h>
 
-#define SEVENZYYEARS 2208988800UL
+#define SEVENZYYEARS 2208988800ULL
+#define NTP_ERA_PIVOT 0x80000000UL  // NTP seconds below this (before 1968) belong to era 1 (after Feb 2036)
 #define NTP_PACKET_SIZE 48
 #define NTP_DEFAULT_LOCAL_PORT 1337
+#define NTP_MAX_SERVERS 4
+#define NTP_MAX_INTERVAL 1024000UL  // Longest poll interval when the clock is stable (ms)
+#define NTP_RETRY_INTERVAL 10000UL  // First retry after a failed update (ms), doubles up to the update interval
+#define NTP_STABLE_OFFSET 100       // Offset considered stable - poll less often (ms)
+#define NTP_STEP_OFFSET 500         // Offset considered unstable - poll often again (ms)
+#define NTP_PROBE_EVERY 4           // Every n-th update also polls another server
+#define NTP_UNKNOWN_SCORE 1000      // Score of a server that was never polled
 #define LEAP_YEAR(Y)     ( (Y>0) && !(Y%4) && ( (Y%100) || !(Y%400) ) )
 
 
+struct NTPServer {
+  const char*   name;
+  uint8_t       reach   = 0;      // Result of last 8 polls (bit 0 = last poll)
+  uint8_t       polls   = 0;      // Number of polls (up to 8)
+  uint16_t      delay   = 0;      // Smoothed round trip (ms)
+  uint16_t      jitter  = 0;      // Smoothed round trip variation (ms)
+};
+
 class NTPClient {
   private:
     UDP*          _udp;
     bool          _udpSetup       = false;
 
-    const char*   _poolServerName = "pool.ntp.org"; // Default time server
+    NTPServer     _servers[NTP_MAX_SERVERS];
+    uint8_t       _serverCount    = 1;
+    uint8_t       _server         = 0;      // Server of last successful update
+    uint8_t       _probe          = 0;      // Last probed server
+    uint8_t       _polls          = 0;
     int           _port           = NTP_DEFAULT_LOCAL_PORT;
     int           _timeOffset     = 0;
 
-    unsigned long _updateInterval = 60000;  // In ms
+    unsigned long _updateInterval = 60000;  // In ms, adapts between _minInterval and _maxInterval
+    unsigned long _minInterval    = 60000;  // In ms
+    unsigned long _maxInterval    = NTP_MAX_INTERVAL;
 
-    unsigned long _currentEpoc    = 0;      // In s
-    unsigned long _lastUpdate     = 0;      // In ms
+    uint64_t      _currentEpoc    = 0;      // In s
+    unsigned long _lastUpdate     = 0;      // In ms, millis() at _currentEpoc
+    unsigned long _lastAttempt    = 0;      // In ms
+    unsigned long _retryInterval  = 0;      // In ms, backoff after failed updates (0 = last update succeeded)
+    bool          _timeSet        = false;
 
     byte          _packetBuffer[NTP_PACKET_SIZE];
+    byte          _originate[8];            // Transmit timestamp of outstanding request
+    bool          _pending        = false;  // Request is waiting for reply
 
-    void          sendNTPPacket();
+    void          sendNTPPacket(const char* server);
     bool          isValid(byte * ntpPacket);
+    bool          query(uint8_t server);
+    uint16_t      score(uint8_t server);
+    unsigned long nextInterval();
 
   public:
     NTPClient(UDP& udp);
@@ -35,6 +65,7 @@ class NTPClient {
     NTPClient(UDP& udp, const char* poolServerName);
     NTPClient(UDP& udp, const char* poolServerName, int timeOffset);
     NTPClient(UDP& udp, const char* poolServerName, int timeOffset, unsigned long updateInterval);
+    NTPClient(UDP& udp, const char* const* poolServerNames, uint8_t count, int timeOffset = 0);
 
     /**
      * Starts the underlying UDP client with the default local port
@@ -47,20 +78,60 @@ class NTPClient {
     void begin(int port);
 
     /**
-     * This should be called in the main loop of your application. By default an update from the NTP Server is only
-     * made every 60 seconds. This can be configured in the NTPClient constructor.
+     * This should be called in the main loop of your application. By default an update from the NTP Server is
+     * made every 60 seconds, the interval doubles up to NTP_MAX_INTERVAL while the clock stays stable.
+     * This can be configured in the NTPClient constructor.
      *
      * @return true on success, false on failure
      */
     bool update();
 
     /**
-     * This will force the update from the NTP Server.
+     * @return true if update() would contact the NTP Server (failed updates are retried
+     *         after NTP_RETRY_INTERVAL, doubling up to the update interval)
+     */
+    bool isUpdateDue();
+
+    /**
+     * @return true after the first successful update
+     */
+    bool isTimeSet();
+
+    /**
+     * @return ms until update() will contact the NTP Server (0 when due)
+     */
+    unsigned long getUpdateDueIn();
+
+    /**
+     * This will force the update from the NTP Server. Servers are tried from the best
+     * (reachable, lowest delay and jitter) until one of them answers.
      *
      * @return true on success, false on failure
      */
     bool forceUpdate();
 
+    /**
+     * Replace the list of NTP servers (the names are not copied)
+     */
+    void setPoolServers(const char* const* poolServerNames, uint8_t count);
+
+    /**
+     * @return server used for the last successful update
+     */
+    const NTPServer& getServer();
+
+    /**
+     * @return server statistics
+     */
+    const NTPServer& getServer(uint8_t index);
+    uint8_t getServerCount();
+    uint8_t getServerIndex();
+
+    /**
+     * @return current update interval in ms
+     */
+    unsigned long getUpdateInterval();
+
     int getDay();
     int getHours();
     int getMinutes();
@@ -86,6 +157,17 @@ class NTPClient {
      * @return time in seconds since Jan. 1, 1970
      */
     unsigned long getEpochTime();
+
+    /**
+     * @return time in seconds since Jan. 1, 1970 (64 bit)
+     */
+    uint64_t getEpochTime64();
+
+    /**
+     * Convert NTP seconds to seconds since Jan. 1, 1970, resolving the NTP era
+     * (timestamps before 1968 are taken as era 1, which starts in February 2036)
+     */
+    static uint64_t ntpToEpoch(uint32_t secsSince1900);
   
     /**
     * @return secs argument (or 0 for current date) formatted to ISO 8601
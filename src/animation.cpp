@@ -0,0 +1,54 @@
+#include "animation.h"
+#include "display.h"
+#include "blit.h"
+
+static const Animation *anim = NULL;    //playing animation
+static int anim_x = 0;                  //bitmap position
+static int anim_y = 0;
+static int anim_clip = 0;               //first column not animated
+static uint8_t anim_frame = 0;          //shown frame
+
+void animationStart(const Animation *animation, int x, int y, int clip) {
+    anim = animation;
+    anim_x = x;
+    anim_y = y;
+    anim_clip = clip;
+    anim_frame = 0;
+}
+
+bool animationActive() {
+    return anim != NULL;
+}
+
+//invert changed bytes of frame against the bitmap
+static void applyFrame(U8G2 &lcd, uint8_t frame) {
+    uint8_t columns = lcd.getBufferTileWidth();
+    int height = lcd.getBufferTileHeight() * 8;
+    uint16_t end = pgm_read_word(anim->starts + frame + 1);
+    if (Display::layout != DISPLAY_HORIZONTAL) lcd.setDrawColor(2);
+
+    for (uint16_t i = pgm_read_word(anim->starts + frame); i < end; i++) {
+        int y = anim_y + pgm_read_byte(anim->deltas + i*3);
+        int x = anim_x + pgm_read_byte(anim->deltas + i*3 + 1) * 8;
+        uint8_t bits = pgm_read_byte(anim->deltas + i*3 + 2);
+        if (y < 0 || y >= height) continue;
+        if (x + 8 > anim_clip) bits &= (x < anim_clip) ? (1 << (anim_clip - x)) - 1 : 0;
+        if (!bits) continue;
+
+        if (Display::layout == DISPLAY_HORIZONTAL) blitXor(blitRow(lcd, y), columns, x, bits);
+        else {
+            for (uint8_t b = 0; b < 8; b++) {
+                if (bits & (1 << b) && x + b >= 0) lcd.drawPixel(x + b, y);
+            }
+        }
+    }
+    if (Display::layout != DISPLAY_HORIZONTAL) lcd.setDrawColor(1);
+}
+
+void animationStep(U8G2 &lcd) {
+    if (!anim) return;
+    uint8_t next = (anim_frame + 1) % anim->frames;
+    applyFrame(lcd, anim_frame);    //back to the bitmap
+    applyFrame(lcd, next);
+    anim_frame = next;
+}
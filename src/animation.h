@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+/*----(MACROS)----*/
+#define ANIMATION_PERIOD 250    //ms per frame
+
+/*----(STRUCT)----*/
+//Animated bitmap, frames are stored as XOR deltas against the bitmap itself
+//(generated by tools/make_animations.py into animations.h).
+typedef struct {
+    uint8_t frames;             //number of frames (frame 0 is the bitmap)
+    const uint16_t *starts;     //first delta of every frame, frames + 1 items (PROGMEM)
+    const uint8_t *deltas;      //row, byte column and xor bits of every delta (PROGMEM)
+} Animation;
+
+/*----(FUNCTIONS)----*/
+//Playback of one animation over a bitmap already drawn in the frame buffer.
+//Stepping inverts only the bytes that differ between the shown and next frame,
+//the flush then sends only rows (tiles) that really changed.
+
+/**
+ * Start animation of bitmap drawn at x, y (frame 0 is shown), NULL stops animating.
+ * Pixels at clip and right of it are never touched (bitmap overlapping other content).
+ */
+void animationStart(const Animation *animation, int x, int y, int clip);
+
+/**
+ * @return true when some animation is playing
+ */
+bool animationActive();
+
+/**
+ * Show next frame (deltas of shown frame are undone, deltas of next frame applied)
+ */
+void animationStep(U8G2 &lcd);
@@ -0,0 +1,327 @@
+//generated by tools/make_animations.py from weather_icons.h, do not edit
+//frame deltas (row, byte column, xor bits) against the bitmap, frame 0 is the bitmap itself
+#pragma once
+
+#include <Arduino.h>
+#include "animation.h"
+
+//few_clouds_day: 4 frames, 352 deltas, 1078 bytes of flash
+static const uint8_t few_clouds_day_deltas[] PROGMEM = {
+    0x00, 0x04, 0x40, 0x00, 0x05, 0x01, 0x01, 0x03, 0xa0, 0x01, 0x04, 0x40, 0x01, 0x05, 0x01, 0x01, 0x06, 0x05, 0x02, 0x03, 0x20, 0x02, 0x04, 0x41,
+    0x02, 0x05, 0x81, 0x02, 0x06, 0x04, 0x03, 0x03, 0x40, 0x03, 0x04, 0x41, 0x03, 0x05, 0x81, 0x03, 0x06, 0x02, 0x04, 0x03, 0x40, 0x04, 0x04, 0x42,
+    0x04, 0x05, 0x41, 0x04, 0x06, 0x02, 0x05, 0x03, 0x80, 0x05, 0x04, 0x02, 0x05, 0x05, 0x40, 0x05, 0x06, 0x01, 0x06, 0x04, 0x10, 0x06, 0x05, 0x08,
+    0x07, 0x04, 0x04, 0x07, 0x05, 0x20, 0x08, 0x04, 0x01, 0x08, 0x05, 0x80, 0x08, 0x06, 0x80, 0x08, 0x07, 0x02, 0x09, 0x03, 0x80, 0x09, 0x06, 0x21,
+    0x09, 0x07, 0x02, 0x0a, 0x03, 0x40, 0x0a, 0x06, 0x12, 0x0a, 0x07, 0x01, 0x0b, 0x03, 0x40, 0x0b, 0x06, 0x54, 0x0c, 0x02, 0x80, 0x0c, 0x03, 0x48,
+    0x0c, 0x06, 0x04, 0x0d, 0x02, 0x10, 0x0d, 0x03, 0xa0, 0x0d, 0x06, 0x08, 0x0e, 0x02, 0x08, 0x0e, 0x03, 0x40, 0x0e, 0x04, 0x01, 0x0e, 0x06, 0x08,
+    0x0f, 0x02, 0x04, 0x0f, 0x03, 0x80, 0x0f, 0x04, 0x01, 0x0f, 0x06, 0x10, 0x10, 0x02, 0x04, 0x10, 0x03, 0x80, 0x10, 0x04, 0x02, 0x10, 0x06, 0x10,
+    0x11, 0x02, 0x04, 0x11, 0x04, 0x03, 0x11, 0x06, 0x10, 0x12, 0x02, 0x02, 0x12, 0x04, 0x81, 0x12, 0x06, 0x50, 0x12, 0x07, 0x08, 0x13, 0x02, 0x02,
+    0x13, 0x04, 0x4a, 0x13, 0x05, 0x02, 0x13, 0x06, 0x50, 0x13, 0x07, 0x08, 0x14, 0x02, 0x02, 0x14, 0x05, 0x05, 0x14, 0x06, 0x10, 0x15, 0x02, 0x02,
+    0x15, 0x05, 0x0a, 0x15, 0x06, 0x10, 0x16, 0x01, 0x40, 0x16, 0x05, 0x0c, 0x16, 0x06, 0x08, 0x17, 0x01, 0x10, 0x17, 0x05, 0x14, 0x17, 0x06, 0x08,
+    0x18, 0x01, 0x04, 0x18, 0x05, 0x18, 0x18, 0x06, 0x04, 0x19, 0x01, 0x02, 0x19, 0x05, 0x28, 0x19, 0x06, 0x54, 0x1a, 0x01, 0x02, 0x1a, 0x05, 0x90,
+    0x1a, 0x06, 0x12, 0x1a, 0x07, 0x01, 0x1b, 0x01, 0x01, 0x1b, 0x05, 0x40, 0x1b, 0x06, 0x20, 0x1b, 0x07, 0x02, 0x1c, 0x01, 0x01, 0x1c, 0x05, 0x80,
+    0x1c, 0x06, 0x80, 0x1c, 0x07, 0x02, 0x1d, 0x01, 0x01, 0x1d, 0x06, 0x01, 0x1e, 0x01, 0x01, 0x1e, 0x06, 0x01, 0x1f, 0x01, 0x01, 0x1f, 0x06, 0x02,
+    0x20, 0x01, 0x01, 0x20, 0x06, 0x02, 0x21, 0x01, 0x02, 0x21, 0x06, 0x02, 0x22, 0x01, 0x02, 0x22, 0x06, 0x01, 0x23, 0x01, 0x04, 0x23, 0x06, 0x01,
+    0x24, 0x01, 0x08, 0x24, 0x05, 0x80, 0x25, 0x01, 0x20, 0x25, 0x05, 0x20, 0x00, 0x04, 0xc0, 0x00, 0x05, 0x03, 0x01, 0x03, 0xe0, 0x01, 0x04, 0xc1,
+    0x01, 0x05, 0x03, 0x01, 0x06, 0x0f, 0x02, 0x03, 0x60, 0x02, 0x04, 0xc3, 0x02, 0x05, 0x83, 0x02, 0x06, 0x0d, 0x03, 0x03, 0xc0, 0x03, 0x04, 0xc3,
+    0x03, 0x05, 0x83, 0x03, 0x06, 0x07, 0x04, 0x03, 0xc0, 0x04, 0x04, 0xc6, 0x04, 0x05, 0xc3, 0x04, 0x06, 0x06, 0x05, 0x03, 0x80, 0x05, 0x04, 0x07,
+    0x05, 0x05, 0xc0, 0x05, 0x06, 0x03, 0x06, 0x04, 0x30, 0x06, 0x05, 0x18, 0x07, 0x04, 0x0c, 0x07, 0x05, 0x60, 0x08, 0x04, 0x03, 0x08, 0x05, 0x80,
+    0x08, 0x06, 0x81, 0x08, 0x07, 0x07, 0x09, 0x03, 0x80, 0x09, 0x04, 0x01, 0x09, 0x06, 0x63, 0x09, 0x07, 0x06, 0x0a, 0x03, 0xc0, 0x0a, 0x06, 0x36,
+    0x0a, 0x07, 0x03, 0x0b, 0x03, 0xc0, 0x0b, 0x06, 0xfc, 0x0c, 0x02, 0x80, 0x0c, 0x03, 0xd9, 0x0c, 0x06, 0x0c, 0x0d, 0x02, 0x30, 0x0d, 0x03, 0xe0,
+    0x0d, 0x04, 0x01, 0x0d, 0x06, 0x18, 0x0e, 0x02, 0x18, 0x0e, 0x03, 0xc0, 0x0e, 0x04, 0x03, 0x0e, 0x06, 0x18, 0x0f, 0x02, 0x0c, 0x0f, 0x03, 0x80,
+    0x0f, 0x04, 0x02, 0x0f, 0x06, 0x30, 0x10, 0x02, 0x0c, 0x10, 0x03, 0x80, 0x10, 0x04, 0x07, 0x10, 0x06, 0x30, 0x11, 0x02, 0x0c, 0x11, 0x04, 0x05,
+    0x11, 0x06, 0x30, 0x12, 0x02, 0x06, 0x12, 0x04, 0x83, 0x12, 0x05, 0x01, 0x12, 0x06, 0xf0, 0x12, 0x07, 0x18, 0x13, 0x02, 0x06, 0x13, 0x04, 0xde,
+    0x13, 0x05, 0x06, 0x13, 0x06, 0xf0, 0x13, 0x07, 0x18, 0x14, 0x02, 0x06, 0x14, 0x05, 0x0f, 0x14, 0x06, 0x30, 0x15, 0x02, 0x06, 0x15, 0x05, 0x1e,
+    0x15, 0x06, 0x30, 0x16, 0x01, 0xc0, 0x16, 0x05, 0x14, 0x16, 0x06, 0x18, 0x17, 0x01, 0x30, 0x17, 0x05, 0x3c, 0x17, 0x06, 0x18, 0x18, 0x01, 0x0c,
+    0x18, 0x05, 0x28, 0x18, 0x06, 0x0c, 0x19, 0x01, 0x06, 0x19, 0x05, 0x78, 0x19, 0x06, 0xfc, 0x1a, 0x01, 0x06, 0x1a, 0x05, 0xb0, 0x1a, 0x06, 0x37,
+    0x1a, 0x07, 0x03, 0x1b, 0x01, 0x03, 0x1b, 0x05, 0xc0, 0x1b, 0x06, 0x60, 0x1b, 0x07, 0x06, 0x1c, 0x01, 0x03, 0x1c, 0x05, 0x80, 0x1c, 0x06, 0x81,
+    0x1c, 0x07, 0x07, 0x1d, 0x01, 0x03, 0x1d, 0x06, 0x03, 0x1e, 0x01, 0x03, 0x1e, 0x06, 0x03, 0x1f, 0x01, 0x03, 0x1f, 0x06, 0x06, 0x20, 0x01, 0x03,
+    0x20, 0x06, 0x06, 0x21, 0x01, 0x06, 0x21, 0x06, 0x06, 0x22, 0x01, 0x06, 0x22, 0x06, 0x03, 0x23, 0x01, 0x0c, 0x23, 0x06, 0x03, 0x24, 0x01, 0x18,
+    0x24, 0x05, 0x80, 0x24, 0x06, 0x01, 0x25, 0x01, 0x60, 0x25, 0x05, 0x60, 0x00, 0x04, 0x40, 0x00, 0x05, 0x01, 0x01, 0x03, 0xa0, 0x01, 0x04, 0x40,
+    0x01, 0x05, 0x01, 0x01, 0x06, 0x05, 0x02, 0x03, 0x20, 0x02, 0x04, 0x41, 0x02, 0x05, 0x81, 0x02, 0x06, 0x04, 0x03, 0x03, 0x40, 0x03, 0x04, 0x41,
+    0x03, 0x05, 0x81, 0x03, 0x06, 0x02, 0x04, 0x03, 0x40, 0x04, 0x04, 0x42, 0x04, 0x05, 0x41, 0x04, 0x06, 0x02, 0x05, 0x03, 0x80, 0x05, 0x04, 0x02,
+    0x05, 0x05, 0x40, 0x05, 0x06, 0x01, 0x06, 0x04, 0x10, 0x06, 0x05, 0x08, 0x07, 0x04, 0x04, 0x07, 0x05, 0x20, 0x08, 0x04, 0x01, 0x08, 0x05, 0x80,
+    0x08, 0x06, 0x80, 0x08, 0x07, 0x02, 0x09, 0x03, 0x80, 0x09, 0x06, 0x21, 0x09, 0x07, 0x02, 0x0a, 0x03, 0x40, 0x0a, 0x06, 0x12, 0x0a, 0x07, 0x01,
+    0x0b, 0x03, 0x40, 0x0b, 0x06, 0x54, 0x0c, 0x02, 0x80, 0x0c, 0x03, 0x48, 0x0c, 0x06, 0x04, 0x0d, 0x02, 0x10, 0x0d, 0x03, 0xa0, 0x0d, 0x06, 0x08,
+    0x0e, 0x02, 0x08, 0x0e, 0x03, 0x40, 0x0e, 0x04, 0x01, 0x0e, 0x06, 0x08, 0x0f, 0x02, 0x04, 0x0f, 0x03, 0x80, 0x0f, 0x04, 0x01, 0x0f, 0x06, 0x10,
+    0x10, 0x02, 0x04, 0x10, 0x03, 0x80, 0x10, 0x04, 0x02, 0x10, 0x06, 0x10, 0x11, 0x02, 0x04, 0x11, 0x04, 0x03, 0x11, 0x06, 0x10, 0x12, 0x02, 0x02,
+    0x12, 0x04, 0x81, 0x12, 0x06, 0x50, 0x12, 0x07, 0x08, 0x13, 0x02, 0x02, 0x13, 0x04, 0x4a, 0x13, 0x05, 0x02, 0x13, 0x06, 0x50, 0x13, 0x07, 0x08,
+    0x14, 0x02, 0x02, 0x14, 0x05, 0x05, 0x14, 0x06, 0x10, 0x15, 0x02, 0x02, 0x15, 0x05, 0x0a, 0x15, 0x06, 0x10, 0x16, 0x01, 0x40, 0x16, 0x05, 0x0c,
+    0x16, 0x06, 0x08, 0x17, 0x01, 0x10, 0x17, 0x05, 0x14, 0x17, 0x06, 0x08, 0x18, 0x01, 0x04, 0x18, 0x05, 0x18, 0x18, 0x06, 0x04, 0x19, 0x01, 0x02,
+    0x19, 0x05, 0x28, 0x19, 0x06, 0x54, 0x1a, 0x01, 0x02, 0x1a, 0x05, 0x90, 0x1a, 0x06, 0x12, 0x1a, 0x07, 0x01, 0x1b, 0x01, 0x01, 0x1b, 0x05, 0x40,
+    0x1b, 0x06, 0x20, 0x1b, 0x07, 0x02, 0x1c, 0x01, 0x01, 0x1c, 0x05, 0x80, 0x1c, 0x06, 0x80, 0x1c, 0x07, 0x02, 0x1d, 0x01, 0x01, 0x1d, 0x06, 0x01,
+    0x1e, 0x01, 0x01, 0x1e, 0x06, 0x01, 0x1f, 0x01, 0x01, 0x1f, 0x06, 0x02, 0x20, 0x01, 0x01, 0x20, 0x06, 0x02, 0x21, 0x01, 0x02, 0x21, 0x06, 0x02,
+    0x22, 0x01, 0x02, 0x22, 0x06, 0x01, 0x23, 0x01, 0x04, 0x23, 0x06, 0x01, 0x24, 0x01, 0x08, 0x24, 0x05, 0x80, 0x25, 0x01, 0x20, 0x25, 0x05, 0x20,
+};
+static const uint16_t few_clouds_day_starts[] PROGMEM = {0, 0, 116, 236, 352};
+static const Animation few_clouds_day_animation = {4, few_clouds_day_starts, few_clouds_day_deltas};
+
+//few_clouds1_night: 4 frames, 241 deltas, 745 bytes of flash
+static const uint8_t few_clouds1_night_deltas[] PROGMEM = {
+    0x05, 0x05, 0x10, 0x05, 0x06, 0x02, 0x06, 0x05, 0x02, 0x06, 0x06, 0x10, 0x07, 0x04, 0x80, 0x07, 0x06, 0x08, 0x08, 0x04, 0x20, 0x08, 0x06, 0x04,
+    0x09, 0x04, 0x10, 0x09, 0x06, 0x01, 0x0a, 0x04, 0x08, 0x0a, 0x05, 0x80, 0x0b, 0x04, 0x04, 0x0b, 0x05, 0x40, 0x0c, 0x02, 0x80, 0x0c, 0x03, 0x08,
+    0x0c, 0x04, 0x04, 0x0c, 0x05, 0x40, 0x0d, 0x02, 0x10, 0x0d, 0x03, 0x20, 0x0d, 0x04, 0x02, 0x0d, 0x05, 0x20, 0x0e, 0x02, 0x08, 0x0e, 0x03, 0x40,
+    0x0e, 0x04, 0x01, 0x0e, 0x05, 0x20, 0x0f, 0x02, 0x04, 0x0f, 0x03, 0x80, 0x0f, 0x04, 0x01, 0x0f, 0x05, 0x10, 0x10, 0x02, 0x04, 0x10, 0x03, 0x80,
+    0x10, 0x04, 0x02, 0x10, 0x05, 0x10, 0x11, 0x02, 0x04, 0x11, 0x04, 0x03, 0x11, 0x05, 0x10, 0x12, 0x02, 0x02, 0x12, 0x04, 0x81, 0x12, 0x05, 0x08,
+    0x13, 0x02, 0x02, 0x13, 0x04, 0x4a, 0x13, 0x05, 0x0a, 0x14, 0x02, 0x02, 0x14, 0x05, 0x0d, 0x15, 0x02, 0x02, 0x15, 0x05, 0x02, 0x16, 0x01, 0x40,
+    0x16, 0x05, 0x04, 0x17, 0x01, 0x10, 0x17, 0x05, 0x04, 0x18, 0x01, 0x04, 0x18, 0x05, 0x08, 0x19, 0x01, 0x02, 0x19, 0x05, 0x08, 0x1a, 0x01, 0x02,
+    0x1a, 0x05, 0x10, 0x1b, 0x01, 0x01, 0x1b, 0x05, 0x40, 0x1c, 0x01, 0x01, 0x1c, 0x05, 0x80, 0x1d, 0x01, 0x01, 0x1d, 0x06, 0x01, 0x1e, 0x01, 0x01,
+    0x1e, 0x06, 0x01, 0x1f, 0x01, 0x01, 0x1f, 0x06, 0x02, 0x20, 0x01, 0x01, 0x20, 0x06, 0x02, 0x21, 0x01, 0x02, 0x21, 0x06, 0x02, 0x22, 0x01, 0x02,
+    0x22, 0x06, 0x01, 0x23, 0x01, 0x04, 0x23, 0x06, 0x01, 0x24, 0x01, 0x08, 0x24, 0x05, 0x80, 0x25, 0x01, 0x20, 0x25, 0x05, 0x20, 0x05, 0x05, 0x30,
+    0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x30, 0x07, 0x04, 0x80, 0x07, 0x05, 0x01, 0x07, 0x06, 0x18, 0x08, 0x04, 0x60, 0x08, 0x06, 0x0c,
+    0x09, 0x04, 0x30, 0x09, 0x06, 0x03, 0x0a, 0x04, 0x18, 0x0a, 0x05, 0x80, 0x0a, 0x06, 0x01, 0x0b, 0x04, 0x0c, 0x0b, 0x05, 0xc0, 0x0c, 0x02, 0x80,
+    0x0c, 0x03, 0x19, 0x0c, 0x04, 0x0c, 0x0c, 0x05, 0xc0, 0x0d, 0x02, 0x30, 0x0d, 0x03, 0x60, 0x0d, 0x04, 0x06, 0x0d, 0x05, 0x60, 0x0e, 0x02, 0x18,
+    0x0e, 0x03, 0xc0, 0x0e, 0x04, 0x03, 0x0e, 0x05, 0x60, 0x0f, 0x02, 0x0c, 0x0f, 0x03, 0x80, 0x0f, 0x04, 0x02, 0x0f, 0x05, 0x30, 0x10, 0x02, 0x0c,
+    0x10, 0x03, 0x80, 0x10, 0x04, 0x07, 0x10, 0x05, 0x30, 0x11, 0x02, 0x0c, 0x11, 0x04, 0x05, 0x11, 0x05, 0x30, 0x12, 0x02, 0x06, 0x12, 0x04, 0x83,
+    0x12, 0x05, 0x19, 0x13, 0x02, 0x06, 0x13, 0x04, 0xde, 0x13, 0x05, 0x1e, 0x14, 0x02, 0x06, 0x14, 0x05, 0x17, 0x15, 0x02, 0x06, 0x15, 0x05, 0x06,
+    0x16, 0x01, 0xc0, 0x16, 0x05, 0x0c, 0x17, 0x01, 0x30, 0x17, 0x05, 0x0c, 0x18, 0x01, 0x0c, 0x18, 0x05, 0x18, 0x19, 0x01, 0x06, 0x19, 0x05, 0x18,
+    0x1a, 0x01, 0x06, 0x1a, 0x05, 0x30, 0x1b, 0x01, 0x03, 0x1b, 0x05, 0xc0, 0x1c, 0x01, 0x03, 0x1c, 0x05, 0x80, 0x1c, 0x06, 0x01, 0x1d, 0x01, 0x03,
+    0x1d, 0x06, 0x03, 0x1e, 0x01, 0x03, 0x1e, 0x06, 0x03, 0x1f, 0x01, 0x03, 0x1f, 0x06, 0x06, 0x20, 0x01, 0x03, 0x20, 0x06, 0x06, 0x21, 0x01, 0x06,
+    0x21, 0x06, 0x06, 0x22, 0x01, 0x06, 0x22, 0x06, 0x03, 0x23, 0x01, 0x0c, 0x23, 0x06, 0x03, 0x24, 0x01, 0x18, 0x24, 0x05, 0x80, 0x24, 0x06, 0x01,
+    0x25, 0x01, 0x60, 0x25, 0x05, 0x60, 0x05, 0x05, 0x10, 0x05, 0x06, 0x02, 0x06, 0x05, 0x02, 0x06, 0x06, 0x10, 0x07, 0x04, 0x80, 0x07, 0x06, 0x08,
+    0x08, 0x04, 0x20, 0x08, 0x06, 0x04, 0x09, 0x04, 0x10, 0x09, 0x06, 0x01, 0x0a, 0x04, 0x08, 0x0a, 0x05, 0x80, 0x0b, 0x04, 0x04, 0x0b, 0x05, 0x40,
+    0x0c, 0x02, 0x80, 0x0c, 0x03, 0x08, 0x0c, 0x04, 0x04, 0x0c, 0x05, 0x40, 0x0d, 0x02, 0x10, 0x0d, 0x03, 0x20, 0x0d, 0x04, 0x02, 0x0d, 0x05, 0x20,
+    0x0e, 0x02, 0x08, 0x0e, 0x03, 0x40, 0x0e, 0x04, 0x01, 0x0e, 0x05, 0x20, 0x0f, 0x02, 0x04, 0x0f, 0x03, 0x80, 0x0f, 0x04, 0x01, 0x0f, 0x05, 0x10,
+    0x10, 0x02, 0x04, 0x10, 0x03, 0x80, 0x10, 0x04, 0x02, 0x10, 0x05, 0x10, 0x11, 0x02, 0x04, 0x11, 0x04, 0x03, 0x11, 0x05, 0x10, 0x12, 0x02, 0x02,
+    0x12, 0x04, 0x81, 0x12, 0x05, 0x08, 0x13, 0x02, 0x02, 0x13, 0x04, 0x4a, 0x13, 0x05, 0x0a, 0x14, 0x02, 0x02, 0x14, 0x05, 0x0d, 0x15, 0x02, 0x02,
+    0x15, 0x05, 0x02, 0x16, 0x01, 0x40, 0x16, 0x05, 0x04, 0x17, 0x01, 0x10, 0x17, 0x05, 0x04, 0x18, 0x01, 0x04, 0x18, 0x05, 0x08, 0x19, 0x01, 0x02,
+    0x19, 0x05, 0x08, 0x1a, 0x01, 0x02, 0x1a, 0x05, 0x10, 0x1b, 0x01, 0x01, 0x1b, 0x05, 0x40, 0x1c, 0x01, 0x01, 0x1c, 0x05, 0x80, 0x1d, 0x01, 0x01,
+    0x1d, 0x06, 0x01, 0x1e, 0x01, 0x01, 0x1e, 0x06, 0x01, 0x1f, 0x01, 0x01, 0x1f, 0x06, 0x02, 0x20, 0x01, 0x01, 0x20, 0x06, 0x02, 0x21, 0x01, 0x02,
+    0x21, 0x06, 0x02, 0x22, 0x01, 0x02, 0x22, 0x06, 0x01, 0x23, 0x01, 0x04, 0x23, 0x06, 0x01, 0x24, 0x01, 0x08, 0x24, 0x05, 0x80, 0x25, 0x01, 0x20,
+    0x25, 0x05, 0x20,
+};
+static const uint16_t few_clouds1_night_starts[] PROGMEM = {0, 0, 79, 162, 241};
+static const Animation few_clouds1_night_animation = {4, few_clouds1_night_starts, few_clouds1_night_deltas};
+
+//scattered_clouds: 4 frames, 191 deltas, 595 bytes of flash
+static const uint8_t scattered_clouds_deltas[] PROGMEM = {
+    0x05, 0x03, 0x84, 0x06, 0x03, 0x01, 0x06, 0x04, 0x01, 0x07, 0x02, 0x80, 0x07, 0x04, 0x04, 0x08, 0x02, 0x20, 0x08, 0x04, 0x08, 0x09, 0x02, 0x10,
+    0x09, 0x04, 0x10, 0x0a, 0x02, 0x10, 0x0a, 0x04, 0x10, 0x0b, 0x02, 0x08, 0x0b, 0x04, 0x20, 0x0c, 0x02, 0x08, 0x0c, 0x04, 0x40, 0x0d, 0x02, 0x04,
+    0x0d, 0x04, 0x40, 0x0d, 0x05, 0x21, 0x0e, 0x02, 0x04, 0x0e, 0x04, 0xc0, 0x0e, 0x05, 0x40, 0x0f, 0x02, 0x04, 0x0f, 0x05, 0x80, 0x10, 0x02, 0x04,
+    0x10, 0x05, 0x80, 0x11, 0x01, 0x80, 0x11, 0x06, 0x01, 0x12, 0x01, 0x10, 0x12, 0x06, 0x01, 0x13, 0x01, 0x08, 0x13, 0x06, 0x01, 0x14, 0x01, 0x04,
+    0x14, 0x06, 0x01, 0x15, 0x01, 0x04, 0x15, 0x06, 0x08, 0x16, 0x01, 0x02, 0x16, 0x06, 0x20, 0x17, 0x01, 0x02, 0x17, 0x06, 0x40, 0x18, 0x01, 0x01,
+    0x18, 0x06, 0x80, 0x19, 0x01, 0x01, 0x19, 0x07, 0x01, 0x1a, 0x01, 0x01, 0x1a, 0x07, 0x01, 0x1b, 0x01, 0x01, 0x1b, 0x07, 0x01, 0x1c, 0x01, 0x02,
+    0x1c, 0x07, 0x01, 0x1d, 0x01, 0x02, 0x1d, 0x07, 0x01, 0x1e, 0x01, 0x04, 0x1e, 0x07, 0x01, 0x1f, 0x01, 0x04, 0x1f, 0x06, 0x80, 0x20, 0x01, 0x08,
+    0x20, 0x06, 0x40, 0x21, 0x01, 0x20, 0x21, 0x06, 0x20, 0x22, 0x01, 0x80, 0x22, 0x06, 0x10, 0x05, 0x03, 0x8c, 0x05, 0x04, 0x01, 0x06, 0x03, 0x03,
+    0x06, 0x04, 0x03, 0x07, 0x02, 0x80, 0x07, 0x03, 0x01, 0x07, 0x04, 0x0c, 0x08, 0x02, 0x60, 0x08, 0x04, 0x18, 0x09, 0x02, 0x30, 0x09, 0x04, 0x30,
+    0x0a, 0x02, 0x30, 0x0a, 0x04, 0x30, 0x0b, 0x02, 0x18, 0x0b, 0x04, 0x60, 0x0c, 0x02, 0x18, 0x0c, 0x04, 0xc0, 0x0d, 0x02, 0x0c, 0x0d, 0x04, 0xc0,
+    0x0d, 0x05, 0x63, 0x0e, 0x02, 0x0c, 0x0e, 0x04, 0x40, 0x0e, 0x05, 0xc1, 0x0f, 0x02, 0x0c, 0x0f, 0x05, 0x80, 0x0f, 0x06, 0x01, 0x10, 0x02, 0x0c,
+    0x10, 0x05, 0x80, 0x10, 0x06, 0x01, 0x11, 0x01, 0x80, 0x11, 0x02, 0x01, 0x11, 0x06, 0x03, 0x12, 0x01, 0x30, 0x12, 0x06, 0x03, 0x13, 0x01, 0x18,
+    0x13, 0x06, 0x03, 0x14, 0x01, 0x0c, 0x14, 0x06, 0x03, 0x15, 0x01, 0x0c, 0x15, 0x06, 0x18, 0x16, 0x01, 0x06, 0x16, 0x06, 0x60, 0x17, 0x01, 0x06,
+    0x17, 0x06, 0xc0, 0x18, 0x01, 0x03, 0x18, 0x06, 0x80, 0x18, 0x07, 0x01, 0x19, 0x01, 0x03, 0x19, 0x07, 0x03, 0x1a, 0x01, 0x03, 0x1a, 0x07, 0x03,
+    0x1b, 0x01, 0x03, 0x1b, 0x07, 0x03, 0x1c, 0x01, 0x06, 0x1c, 0x07, 0x03, 0x1d, 0x01, 0x06, 0x1d, 0x07, 0x03, 0x1e, 0x01, 0x0c, 0x1e, 0x07, 0x03,
+    0x1f, 0x01, 0x0c, 0x1f, 0x06, 0x80, 0x1f, 0x07, 0x01, 0x20, 0x01, 0x18, 0x20, 0x06, 0xc0, 0x21, 0x01, 0x60, 0x21, 0x06, 0x60, 0x22, 0x01, 0x80,
+    0x22, 0x02, 0x01, 0x22, 0x06, 0x30, 0x05, 0x03, 0x84, 0x06, 0x03, 0x01, 0x06, 0x04, 0x01, 0x07, 0x02, 0x80, 0x07, 0x04, 0x04, 0x08, 0x02, 0x20,
+    0x08, 0x04, 0x08, 0x09, 0x02, 0x10, 0x09, 0x04, 0x10, 0x0a, 0x02, 0x10, 0x0a, 0x04, 0x10, 0x0b, 0x02, 0x08, 0x0b, 0x04, 0x20, 0x0c, 0x02, 0x08,
+    0x0c, 0x04, 0x40, 0x0d, 0x02, 0x04, 0x0d, 0x04, 0x40, 0x0d, 0x05, 0x21, 0x0e, 0x02, 0x04, 0x0e, 0x04, 0xc0, 0x0e, 0x05, 0x40, 0x0f, 0x02, 0x04,
+    0x0f, 0x05, 0x80, 0x10, 0x02, 0x04, 0x10, 0x05, 0x80, 0x11, 0x01, 0x80, 0x11, 0x06, 0x01, 0x12, 0x01, 0x10, 0x12, 0x06, 0x01, 0x13, 0x01, 0x08,
+    0x13, 0x06, 0x01, 0x14, 0x01, 0x04, 0x14, 0x06, 0x01, 0x15, 0x01, 0x04, 0x15, 0x06, 0x08, 0x16, 0x01, 0x02, 0x16, 0x06, 0x20, 0x17, 0x01, 0x02,
+    0x17, 0x06, 0x40, 0x18, 0x01, 0x01, 0x18, 0x06, 0x80, 0x19, 0x01, 0x01, 0x19, 0x07, 0x01, 0x1a, 0x01, 0x01, 0x1a, 0x07, 0x01, 0x1b, 0x01, 0x01,
+    0x1b, 0x07, 0x01, 0x1c, 0x01, 0x02, 0x1c, 0x07, 0x01, 0x1d, 0x01, 0x02, 0x1d, 0x07, 0x01, 0x1e, 0x01, 0x04, 0x1e, 0x07, 0x01, 0x1f, 0x01, 0x04,
+    0x1f, 0x06, 0x80, 0x20, 0x01, 0x08, 0x20, 0x06, 0x40, 0x21, 0x01, 0x20, 0x21, 0x06, 0x20, 0x22, 0x01, 0x80, 0x22, 0x06, 0x10,
+};
+static const uint16_t scattered_clouds_starts[] PROGMEM = {0, 0, 61, 130, 191};
+static const Animation scattered_clouds_animation = {4, scattered_clouds_starts, scattered_clouds_deltas};
+
+//broken_clouds: 4 frames, 247 deltas, 763 bytes of flash
+static const uint8_t broken_clouds_deltas[] PROGMEM = {
+    0x05, 0x04, 0x84, 0x06, 0x04, 0x01, 0x06, 0x05, 0x01, 0x07, 0x03, 0x80, 0x07, 0x05, 0x02, 0x08, 0x03, 0x40, 0x08, 0x05, 0x04, 0x09, 0x02, 0x80,
+    0x09, 0x03, 0x48, 0x09, 0x05, 0x08, 0x0a, 0x02, 0x10, 0x0a, 0x03, 0xa0, 0x0a, 0x05, 0xa8, 0x0b, 0x02, 0x08, 0x0b, 0x03, 0x40, 0x0b, 0x04, 0x01,
+    0x0b, 0x06, 0x02, 0x0c, 0x02, 0x04, 0x0c, 0x03, 0x80, 0x0c, 0x04, 0x02, 0x0c, 0x06, 0x04, 0x0d, 0x02, 0x04, 0x0d, 0x04, 0x05, 0x0d, 0x06, 0x04,
+    0x0e, 0x02, 0x04, 0x0e, 0x04, 0x06, 0x0e, 0x06, 0x08, 0x0f, 0x02, 0x02, 0x0f, 0x04, 0x82, 0x0f, 0x06, 0x08, 0x10, 0x02, 0x02, 0x10, 0x04, 0x40,
+    0x10, 0x05, 0x02, 0x10, 0x06, 0x10, 0x11, 0x02, 0x02, 0x11, 0x05, 0x05, 0x11, 0x06, 0x40, 0x12, 0x02, 0x02, 0x12, 0x05, 0x06, 0x12, 0x06, 0x80,
+    0x13, 0x01, 0x40, 0x13, 0x05, 0x0a, 0x13, 0x06, 0x80, 0x14, 0x01, 0x10, 0x14, 0x05, 0x0c, 0x14, 0x07, 0x01, 0x15, 0x01, 0x04, 0x15, 0x05, 0x24,
+    0x15, 0x07, 0x01, 0x16, 0x01, 0x02, 0x16, 0x05, 0x50, 0x16, 0x07, 0x01, 0x17, 0x01, 0x02, 0x17, 0x05, 0xa0, 0x17, 0x06, 0x80, 0x18, 0x01, 0x01,
+    0x18, 0x05, 0x40, 0x18, 0x06, 0x81, 0x19, 0x01, 0x01, 0x19, 0x05, 0x80, 0x19, 0x06, 0x42, 0x1a, 0x01, 0x01, 0x1a, 0x06, 0x15, 0x1b, 0x01, 0x01,
+    0x1b, 0x06, 0x02, 0x1c, 0x01, 0x01, 0x1c, 0x06, 0x02, 0x1d, 0x01, 0x01, 0x1d, 0x06, 0x02, 0x1e, 0x01, 0x02, 0x1e, 0x06, 0x02, 0x1f, 0x01, 0x02,
+    0x1f, 0x06, 0x01, 0x20, 0x01, 0x04, 0x20, 0x06, 0x01, 0x21, 0x01, 0x08, 0x21, 0x05, 0x80, 0x22, 0x01, 0x20, 0x22, 0x05, 0x20, 0x05, 0x04, 0x8c,
+    0x05, 0x05, 0x01, 0x06, 0x04, 0x03, 0x06, 0x05, 0x03, 0x07, 0x03, 0x80, 0x07, 0x04, 0x01, 0x07, 0x05, 0x06, 0x08, 0x03, 0xc0, 0x08, 0x05, 0x0c,
+    0x09, 0x02, 0x80, 0x09, 0x03, 0xd9, 0x09, 0x05, 0x18, 0x0a, 0x02, 0x30, 0x0a, 0x03, 0xe0, 0x0a, 0x04, 0x01, 0x0a, 0x05, 0xf8, 0x0a, 0x06, 0x01,
+    0x0b, 0x02, 0x18, 0x0b, 0x03, 0xc0, 0x0b, 0x04, 0x03, 0x0b, 0x06, 0x06, 0x0c, 0x02, 0x0c, 0x0c, 0x03, 0x80, 0x0c, 0x04, 0x07, 0x0c, 0x06, 0x0c,
+    0x0d, 0x02, 0x0c, 0x0d, 0x04, 0x0f, 0x0d, 0x06, 0x0c, 0x0e, 0x02, 0x0c, 0x0e, 0x04, 0x0a, 0x0e, 0x06, 0x18, 0x0f, 0x02, 0x06, 0x0f, 0x04, 0x86,
+    0x0f, 0x05, 0x01, 0x0f, 0x06, 0x18, 0x10, 0x02, 0x06, 0x10, 0x04, 0xc0, 0x10, 0x05, 0x06, 0x10, 0x06, 0x30, 0x11, 0x02, 0x06, 0x11, 0x05, 0x0f,
+    0x11, 0x06, 0xc0, 0x12, 0x02, 0x06, 0x12, 0x05, 0x0a, 0x12, 0x06, 0x80, 0x12, 0x07, 0x01, 0x13, 0x01, 0xc0, 0x13, 0x05, 0x1e, 0x13, 0x06, 0x80,
+    0x13, 0x07, 0x01, 0x14, 0x01, 0x30, 0x14, 0x05, 0x14, 0x14, 0x07, 0x03, 0x15, 0x01, 0x0c, 0x15, 0x05, 0x6c, 0x15, 0x07, 0x03, 0x16, 0x01, 0x06,
+    0x16, 0x05, 0xf0, 0x16, 0x07, 0x03, 0x17, 0x01, 0x06, 0x17, 0x05, 0xe0, 0x17, 0x06, 0x81, 0x17, 0x07, 0x01, 0x18, 0x01, 0x03, 0x18, 0x05, 0xc0,
+    0x18, 0x06, 0x83, 0x18, 0x07, 0x01, 0x19, 0x01, 0x03, 0x19, 0x05, 0x80, 0x19, 0x06, 0xc7, 0x1a, 0x01, 0x03, 0x1a, 0x06, 0x3f, 0x1b, 0x01, 0x03,
+    0x1b, 0x06, 0x06, 0x1c, 0x01, 0x03, 0x1c, 0x06, 0x06, 0x1d, 0x01, 0x03, 0x1d, 0x06, 0x06, 0x1e, 0x01, 0x06, 0x1e, 0x06, 0x06, 0x1f, 0x01, 0x06,
+    0x1f, 0x06, 0x03, 0x20, 0x01, 0x0c, 0x20, 0x06, 0x03, 0x21, 0x01, 0x18, 0x21, 0x05, 0x80, 0x21, 0x06, 0x01, 0x22, 0x01, 0x60, 0x22, 0x05, 0x60,
+    0x05, 0x04, 0x84, 0x06, 0x04, 0x01, 0x06, 0x05, 0x01, 0x07, 0x03, 0x80, 0x07, 0x05, 0x02, 0x08, 0x03, 0x40, 0x08, 0x05, 0x04, 0x09, 0x02, 0x80,
+    0x09, 0x03, 0x48, 0x09, 0x05, 0x08, 0x0a, 0x02, 0x10, 0x0a, 0x03, 0xa0, 0x0a, 0x05, 0xa8, 0x0b, 0x02, 0x08, 0x0b, 0x03, 0x40, 0x0b, 0x04, 0x01,
+    0x0b, 0x06, 0x02, 0x0c, 0x02, 0x04, 0x0c, 0x03, 0x80, 0x0c, 0x04, 0x02, 0x0c, 0x06, 0x04, 0x0d, 0x02, 0x04, 0x0d, 0x04, 0x05, 0x0d, 0x06, 0x04,
+    0x0e, 0x02, 0x04, 0x0e, 0x04, 0x06, 0x0e, 0x06, 0x08, 0x0f, 0x02, 0x02, 0x0f, 0x04, 0x82, 0x0f, 0x06, 0x08, 0x10, 0x02, 0x02, 0x10, 0x04, 0x40,
+    0x10, 0x05, 0x02, 0x10, 0x06, 0x10, 0x11, 0x02, 0x02, 0x11, 0x05, 0x05, 0x11, 0x06, 0x40, 0x12, 0x02, 0x02, 0x12, 0x05, 0x06, 0x12, 0x06, 0x80,
+    0x13, 0x01, 0x40, 0x13, 0x05, 0x0a, 0x13, 0x06, 0x80, 0x14, 0x01, 0x10, 0x14, 0x05, 0x0c, 0x14, 0x07, 0x01, 0x15, 0x01, 0x04, 0x15, 0x05, 0x24,
+    0x15, 0x07, 0x01, 0x16, 0x01, 0x02, 0x16, 0x05, 0x50, 0x16, 0x07, 0x01, 0x17, 0x01, 0x02, 0x17, 0x05, 0xa0, 0x17, 0x06, 0x80, 0x18, 0x01, 0x01,
+    0x18, 0x05, 0x40, 0x18, 0x06, 0x81, 0x19, 0x01, 0x01, 0x19, 0x05, 0x80, 0x19, 0x06, 0x42, 0x1a, 0x01, 0x01, 0x1a, 0x06, 0x15, 0x1b, 0x01, 0x01,
+    0x1b, 0x06, 0x02, 0x1c, 0x01, 0x01, 0x1c, 0x06, 0x02, 0x1d, 0x01, 0x01, 0x1d, 0x06, 0x02, 0x1e, 0x01, 0x02, 0x1e, 0x06, 0x02, 0x1f, 0x01, 0x02,
+    0x1f, 0x06, 0x01, 0x20, 0x01, 0x04, 0x20, 0x06, 0x01, 0x21, 0x01, 0x08, 0x21, 0x05, 0x80, 0x22, 0x01, 0x20, 0x22, 0x05, 0x20,
+};
+static const uint16_t broken_clouds_starts[] PROGMEM = {0, 0, 79, 168, 247};
+static const Animation broken_clouds_animation = {4, broken_clouds_starts, broken_clouds_deltas};
+
+//shower_rain: 5 frames, 179 deltas, 561 bytes of flash
+static const uint8_t shower_rain_deltas[] PROGMEM = {
+    0x1f, 0x01, 0x80, 0x1f, 0x02, 0x01, 0x1f, 0x03, 0x80, 0x1f, 0x04, 0x81, 0x1f, 0x05, 0x01, 0x20, 0x01, 0x80, 0x20, 0x02, 0x01, 0x20, 0x03, 0x0c,
+    0x20, 0x04, 0x80, 0x20, 0x05, 0x01, 0x21, 0x01, 0x40, 0x21, 0x03, 0x0c, 0x21, 0x04, 0x40, 0x22, 0x01, 0x40, 0x22, 0x02, 0x01, 0x22, 0x03, 0x02,
+    0x22, 0x04, 0x40, 0x22, 0x05, 0x01, 0x23, 0x02, 0x31, 0x23, 0x03, 0x0a, 0x23, 0x05, 0x01, 0x24, 0x01, 0xc0, 0x24, 0x02, 0x30, 0x24, 0x03, 0x08,
+    0x24, 0x04, 0xc3, 0x25, 0x01, 0xc0, 0x25, 0x02, 0x08, 0x25, 0x03, 0x06, 0x25, 0x04, 0xc3, 0x26, 0x02, 0x28, 0x26, 0x03, 0x86, 0x27, 0x02, 0x20,
+    0x27, 0x03, 0x80, 0x27, 0x04, 0x02, 0x28, 0x02, 0x18, 0x28, 0x04, 0x02, 0x29, 0x02, 0x18, 0x29, 0x03, 0x80, 0x29, 0x04, 0x01, 0x1f, 0x01, 0x80,
+    0x1f, 0x02, 0x19, 0x1f, 0x03, 0x80, 0x1f, 0x04, 0x83, 0x1f, 0x05, 0x01, 0x20, 0x01, 0x80, 0x20, 0x02, 0x19, 0x20, 0x03, 0x8c, 0x20, 0x04, 0x81,
+    0x20, 0x05, 0x01, 0x21, 0x01, 0xc0, 0x21, 0x02, 0x01, 0x21, 0x03, 0x8c, 0x21, 0x04, 0xc1, 0x21, 0x05, 0x01, 0x22, 0x01, 0xc0, 0x22, 0x03, 0x0e,
+    0x22, 0x04, 0xc0, 0x23, 0x01, 0x40, 0x23, 0x02, 0x31, 0x23, 0x03, 0x06, 0x23, 0x04, 0x40, 0x23, 0x05, 0x01, 0x24, 0x01, 0x80, 0x24, 0x02, 0x31,
+    0x24, 0x03, 0x0a, 0x24, 0x04, 0x83, 0x24, 0x05, 0x01, 0x25, 0x01, 0xc0, 0x25, 0x02, 0x39, 0x25, 0x03, 0x0c, 0x25, 0x04, 0xc3, 0x25, 0x05, 0x01,
+    0x26, 0x01, 0xc0, 0x26, 0x02, 0x18, 0x26, 0x03, 0x8e, 0x26, 0x04, 0xc3, 0x27, 0x01, 0xc0, 0x27, 0x02, 0x28, 0x27, 0x03, 0x86, 0x27, 0x04, 0xc1,
+    0x28, 0x02, 0x30, 0x28, 0x03, 0x86, 0x28, 0x04, 0x02, 0x29, 0x02, 0x38, 0x29, 0x04, 0x03, 0x1f, 0x01, 0x80, 0x1f, 0x02, 0x31, 0x1f, 0x03, 0x06,
+    0x1f, 0x04, 0x83, 0x1f, 0x05, 0x01, 0x20, 0x01, 0x80, 0x20, 0x02, 0x39, 0x20, 0x03, 0x0c, 0x20, 0x04, 0x83, 0x20, 0x05, 0x01, 0x21, 0x01, 0xc0,
+    0x21, 0x02, 0x19, 0x21, 0x03, 0x8c, 0x21, 0x04, 0xc3, 0x21, 0x05, 0x01, 0x22, 0x01, 0xc0, 0x22, 0x02, 0x18, 0x22, 0x03, 0x8e, 0x22, 0x04, 0xc1,
+    0x23, 0x01, 0xc0, 0x23, 0x02, 0x30, 0x23, 0x03, 0x86, 0x23, 0x04, 0xc1, 0x24, 0x02, 0x30, 0x24, 0x03, 0x06, 0x24, 0x04, 0x03, 0x25, 0x01, 0x80,
+    0x25, 0x02, 0x39, 0x25, 0x04, 0x83, 0x25, 0x05, 0x01, 0x26, 0x01, 0x80, 0x26, 0x02, 0x19, 0x26, 0x03, 0x8c, 0x26, 0x04, 0x83, 0x26, 0x05, 0x01,
+    0x27, 0x01, 0xc0, 0x27, 0x02, 0x19, 0x27, 0x03, 0x8c, 0x27, 0x04, 0xc1, 0x27, 0x05, 0x01, 0x28, 0x01, 0xc0, 0x28, 0x03, 0x8e, 0x28, 0x04, 0xc1,
+    0x29, 0x01, 0xc0, 0x29, 0x02, 0x30, 0x29, 0x03, 0x06, 0x29, 0x04, 0xc0, 0x1f, 0x01, 0x40, 0x1f, 0x02, 0x01, 0x1f, 0x03, 0x0e, 0x1f, 0x04, 0x40,
+    0x1f, 0x05, 0x01, 0x20, 0x01, 0x40, 0x20, 0x02, 0x31, 0x20, 0x03, 0x0a, 0x20, 0x04, 0x40, 0x20, 0x05, 0x01, 0x21, 0x01, 0xc0, 0x21, 0x02, 0x31,
+    0x21, 0x03, 0x0a, 0x21, 0x04, 0xc3, 0x21, 0x05, 0x01, 0x22, 0x01, 0xc0, 0x22, 0x02, 0x38, 0x22, 0x03, 0x0e, 0x22, 0x04, 0xc3, 0x23, 0x01, 0xc0,
+    0x23, 0x02, 0x28, 0x23, 0x03, 0x86, 0x23, 0x04, 0xc3, 0x24, 0x02, 0x28, 0x24, 0x03, 0x86, 0x24, 0x04, 0x02, 0x25, 0x02, 0x38, 0x25, 0x03, 0x80,
+    0x25, 0x04, 0x02, 0x26, 0x02, 0x18, 0x26, 0x03, 0x80, 0x26, 0x04, 0x03, 0x27, 0x01, 0x80, 0x27, 0x02, 0x19, 0x27, 0x03, 0x80, 0x27, 0x04, 0x81,
+    0x27, 0x05, 0x01, 0x28, 0x01, 0x80, 0x28, 0x02, 0x01, 0x28, 0x03, 0x8c, 0x28, 0x04, 0x81, 0x28, 0x05, 0x01, 0x29, 0x01, 0xc0, 0x29, 0x02, 0x01,
+    0x29, 0x03, 0x0c, 0x29, 0x04, 0xc0, 0x29, 0x05, 0x01,
+};
+static const uint16_t shower_rain_starts[] PROGMEM = {0, 0, 39, 85, 132, 179};
+static const Animation shower_rain_animation = {5, shower_rain_starts, shower_rain_deltas};
+
+//rain_day: 5 frames, 134 deltas, 426 bytes of flash
+static const uint8_t rain_day_deltas[] PROGMEM = {
+    0x21, 0x02, 0x63, 0x21, 0x04, 0x18, 0x21, 0x05, 0x18, 0x22, 0x03, 0xc0, 0x23, 0x01, 0x80, 0x23, 0x05, 0x04, 0x24, 0x02, 0x02, 0x24, 0x03, 0x20,
+    0x24, 0x05, 0x10, 0x25, 0x02, 0xc0, 0x25, 0x03, 0x80, 0x25, 0x04, 0x30, 0x26, 0x01, 0x80, 0x26, 0x02, 0x01, 0x26, 0x05, 0x0c, 0x27, 0x02, 0x20,
+    0x27, 0x03, 0x60, 0x27, 0x04, 0x08, 0x28, 0x02, 0x80, 0x28, 0x04, 0x20, 0x21, 0x02, 0xe3, 0x21, 0x04, 0x38, 0x21, 0x05, 0x18, 0x22, 0x02, 0x63,
+    0x22, 0x03, 0xc0, 0x22, 0x04, 0x18, 0x22, 0x05, 0x18, 0x23, 0x01, 0x80, 0x23, 0x02, 0x63, 0x23, 0x03, 0xc0, 0x23, 0x04, 0x18, 0x23, 0x05, 0x1c,
+    0x24, 0x01, 0x80, 0x24, 0x02, 0x02, 0x24, 0x03, 0xe0, 0x24, 0x05, 0x14, 0x25, 0x01, 0x80, 0x25, 0x02, 0xc2, 0x25, 0x03, 0xa0, 0x25, 0x04, 0x30,
+    0x25, 0x05, 0x14, 0x26, 0x01, 0x80, 0x26, 0x02, 0xc3, 0x26, 0x03, 0xa0, 0x26, 0x04, 0x30, 0x26, 0x05, 0x1c, 0x27, 0x01, 0x80, 0x27, 0x02, 0xe1,
+    0x27, 0x03, 0xe0, 0x27, 0x04, 0x38, 0x27, 0x05, 0x0c, 0x28, 0x01, 0x80, 0x28, 0x02, 0xa1, 0x28, 0x03, 0x60, 0x28, 0x04, 0x28, 0x28, 0x05, 0x0c,
+    0x29, 0x02, 0xa0, 0x29, 0x03, 0x60, 0x29, 0x04, 0x28, 0x21, 0x01, 0x80, 0x21, 0x02, 0xc2, 0x21, 0x03, 0x60, 0x21, 0x04, 0x30, 0x21, 0x05, 0x14,
+    0x22, 0x02, 0xc3, 0x22, 0x03, 0xa0, 0x22, 0x04, 0x30, 0x22, 0x05, 0x18, 0x23, 0x01, 0x80, 0x23, 0x02, 0xe3, 0x23, 0x03, 0xc0, 0x23, 0x04, 0x38,
+    0x23, 0x05, 0x1c, 0x24, 0x01, 0x80, 0x24, 0x02, 0x61, 0x24, 0x03, 0xe0, 0x24, 0x04, 0x18, 0x24, 0x05, 0x0c, 0x25, 0x01, 0x80, 0x25, 0x02, 0xa1,
+    0x25, 0x03, 0x60, 0x25, 0x04, 0x28, 0x25, 0x05, 0x0c, 0x26, 0x02, 0xc3, 0x26, 0x03, 0x60, 0x26, 0x04, 0x30, 0x26, 0x05, 0x18, 0x27, 0x02, 0xe3,
+    0x27, 0x03, 0xc0, 0x27, 0x04, 0x38, 0x27, 0x05, 0x18, 0x28, 0x01, 0x80, 0x28, 0x02, 0x63, 0x28, 0x03, 0xc0, 0x28, 0x04, 0x18, 0x28, 0x05, 0x1c,
+    0x29, 0x01, 0x80, 0x29, 0x02, 0x61, 0x29, 0x03, 0xe0, 0x29, 0x04, 0x18, 0x29, 0x05, 0x0c, 0x21, 0x01, 0x80, 0x21, 0x03, 0xc0, 0x21, 0x05, 0x04,
+    0x22, 0x01, 0x80, 0x22, 0x02, 0x02, 0x22, 0x03, 0x20, 0x22, 0x05, 0x14, 0x23, 0x02, 0xc2, 0x23, 0x03, 0xa0, 0x23, 0x04, 0x30, 0x23, 0x05, 0x10,
+    0x24, 0x01, 0x80, 0x24, 0x02, 0xc1, 0x24, 0x03, 0x80, 0x24, 0x04, 0x30, 0x24, 0x05, 0x0c, 0x25, 0x01, 0x80, 0x25, 0x02, 0x21, 0x25, 0x03, 0x60,
+    0x25, 0x04, 0x08, 0x25, 0x05, 0x0c, 0x26, 0x02, 0xa0, 0x26, 0x03, 0x60, 0x26, 0x04, 0x28, 0x27, 0x02, 0x80, 0x27, 0x04, 0x20, 0x28, 0x02, 0x63,
+    0x28, 0x04, 0x18, 0x28, 0x05, 0x18, 0x29, 0x02, 0x63, 0x29, 0x03, 0xc0, 0x29, 0x04, 0x18, 0x29, 0x05, 0x18,
+};
+static const uint16_t rain_day_starts[] PROGMEM = {0, 0, 20, 59, 101, 134};
+static const Animation rain_day_animation = {5, rain_day_starts, rain_day_deltas};
+
+//rain_night: 5 frames, 134 deltas, 426 bytes of flash
+static const uint8_t rain_night_deltas[] PROGMEM = {
+    0x21, 0x02, 0x63, 0x21, 0x04, 0x18, 0x21, 0x05, 0x18, 0x22, 0x03, 0xc0, 0x23, 0x01, 0x80, 0x23, 0x05, 0x04, 0x24, 0x02, 0x02, 0x24, 0x03, 0x20,
+    0x24, 0x05, 0x10, 0x25, 0x02, 0xc0, 0x25, 0x03, 0x80, 0x25, 0x04, 0x30, 0x26, 0x01, 0x80, 0x26, 0x02, 0x01, 0x26, 0x05, 0x0c, 0x27, 0x02, 0x20,
+    0x27, 0x03, 0x60, 0x27, 0x04, 0x08, 0x28, 0x02, 0x80, 0x28, 0x04, 0x20, 0x21, 0x02, 0xe3, 0x21, 0x04, 0x38, 0x21, 0x05, 0x18, 0x22, 0x02, 0x63,
+    0x22, 0x03, 0xc0, 0x22, 0x04, 0x18, 0x22, 0x05, 0x18, 0x23, 0x01, 0x80, 0x23, 0x02, 0x63, 0x23, 0x03, 0xc0, 0x23, 0x04, 0x18, 0x23, 0x05, 0x1c,
+    0x24, 0x01, 0x80, 0x24, 0x02, 0x02, 0x24, 0x03, 0xe0, 0x24, 0x05, 0x14, 0x25, 0x01, 0x80, 0x25, 0x02, 0xc2, 0x25, 0x03, 0xa0, 0x25, 0x04, 0x30,
+    0x25, 0x05, 0x14, 0x26, 0x01, 0x80, 0x26, 0x02, 0xc3, 0x26, 0x03, 0xa0, 0x26, 0x04, 0x30, 0x26, 0x05, 0x1c, 0x27, 0x01, 0x80, 0x27, 0x02, 0xe1,
+    0x27, 0x03, 0xe0, 0x27, 0x04, 0x38, 0x27, 0x05, 0x0c, 0x28, 0x01, 0x80, 0x28, 0x02, 0xa1, 0x28, 0x03, 0x60, 0x28, 0x04, 0x28, 0x28, 0x05, 0x0c,
+    0x29, 0x02, 0xa0, 0x29, 0x03, 0x60, 0x29, 0x04, 0x28, 0x21, 0x01, 0x80, 0x21, 0x02, 0xc2, 0x21, 0x03, 0x60, 0x21, 0x04, 0x30, 0x21, 0x05, 0x14,
+    0x22, 0x02, 0xc3, 0x22, 0x03, 0xa0, 0x22, 0x04, 0x30, 0x22, 0x05, 0x18, 0x23, 0x01, 0x80, 0x23, 0x02, 0xe3, 0x23, 0x03, 0xc0, 0x23, 0x04, 0x38,
+    0x23, 0x05, 0x1c, 0x24, 0x01, 0x80, 0x24, 0x02, 0x61, 0x24, 0x03, 0xe0, 0x24, 0x04, 0x18, 0x24, 0x05, 0x0c, 0x25, 0x01, 0x80, 0x25, 0x02, 0xa1,
+    0x25, 0x03, 0x60, 0x25, 0x04, 0x28, 0x25, 0x05, 0x0c, 0x26, 0x02, 0xc3, 0x26, 0x03, 0x60, 0x26, 0x04, 0x30, 0x26, 0x05, 0x18, 0x27, 0x02, 0xe3,
+    0x27, 0x03, 0xc0, 0x27, 0x04, 0x38, 0x27, 0x05, 0x18, 0x28, 0x01, 0x80, 0x28, 0x02, 0x63, 0x28, 0x03, 0xc0, 0x28, 0x04, 0x18, 0x28, 0x05, 0x1c,
+    0x29, 0x01, 0x80, 0x29, 0x02, 0x61, 0x29, 0x03, 0xe0, 0x29, 0x04, 0x18, 0x29, 0x05, 0x0c, 0x21, 0x01, 0x80, 0x21, 0x03, 0xc0, 0x21, 0x05, 0x04,
+    0x22, 0x01, 0x80, 0x22, 0x02, 0x02, 0x22, 0x03, 0x20, 0x22, 0x05, 0x14, 0x23, 0x02, 0xc2, 0x23, 0x03, 0xa0, 0x23, 0x04, 0x30, 0x23, 0x05, 0x10,
+    0x24, 0x01, 0x80, 0x24, 0x02, 0xc1, 0x24, 0x03, 0x80, 0x24, 0x04, 0x30, 0x24, 0x05, 0x0c, 0x25, 0x01, 0x80, 0x25, 0x02, 0x21, 0x25, 0x03, 0x60,
+    0x25, 0x04, 0x08, 0x25, 0x05, 0x0c, 0x26, 0x02, 0xa0, 0x26, 0x03, 0x60, 0x26, 0x04, 0x28, 0x27, 0x02, 0x80, 0x27, 0x04, 0x20, 0x28, 0x02, 0x63,
+    0x28, 0x04, 0x18, 0x28, 0x05, 0x18, 0x29, 0x02, 0x63, 0x29, 0x03, 0xc0, 0x29, 0x04, 0x18, 0x29, 0x05, 0x18,
+};
+static const uint16_t rain_night_starts[] PROGMEM = {0, 0, 20, 59, 101, 134};
+static const Animation rain_night_animation = {5, rain_night_starts, rain_night_deltas};
+
+//thunderstorm: 4 frames, 180 deltas, 562 bytes of flash
+static const uint8_t thunderstorm_deltas[] PROGMEM = {
+    0x1f, 0x01, 0x60, 0x1f, 0x03, 0x78, 0x1f, 0x04, 0x30, 0x20, 0x01, 0x60, 0x20, 0x03, 0x3c, 0x20, 0x04, 0x30, 0x21, 0x01, 0x70, 0x21, 0x03, 0x1c,
+    0x21, 0x04, 0x38, 0x22, 0x01, 0x30, 0x22, 0x02, 0x30, 0x22, 0x03, 0x0e, 0x22, 0x04, 0x18, 0x23, 0x01, 0x30, 0x23, 0x02, 0x30, 0x23, 0x03, 0x06,
+    0x23, 0x04, 0x18, 0x23, 0x05, 0x0c, 0x24, 0x02, 0x38, 0x24, 0x03, 0xc3, 0x24, 0x05, 0x0c, 0x25, 0x02, 0x18, 0x25, 0x03, 0xc1, 0x25, 0x05, 0x0e,
+    0x26, 0x02, 0x18, 0x26, 0x03, 0xe0, 0x26, 0x05, 0x06, 0x27, 0x03, 0x60, 0x27, 0x05, 0x06, 0x28, 0x03, 0x60, 0x00, 0x04, 0x7c, 0x01, 0x04, 0xff,
+    0x02, 0x03, 0x80, 0x02, 0x04, 0xff, 0x02, 0x05, 0x01, 0x03, 0x03, 0xc0, 0x03, 0x04, 0xff, 0x03, 0x05, 0x03, 0x04, 0x02, 0x80, 0x04, 0x03, 0xff,
+    0x04, 0x04, 0xff, 0x04, 0x05, 0x07, 0x05, 0x02, 0xf0, 0x05, 0x03, 0xff, 0x05, 0x04, 0xff, 0x05, 0x05, 0x7f, 0x06, 0x02, 0xf8, 0x06, 0x03, 0xff,
+    0x06, 0x04, 0xff, 0x06, 0x05, 0xff, 0x06, 0x06, 0x01, 0x07, 0x02, 0xfc, 0x07, 0x03, 0xff, 0x07, 0x04, 0xff, 0x07, 0x05, 0xff, 0x07, 0x06, 0x03,
+    0x08, 0x02, 0xfc, 0x08, 0x03, 0xff, 0x08, 0x04, 0xff, 0x08, 0x05, 0xff, 0x08, 0x06, 0x03, 0x09, 0x02, 0xfc, 0x09, 0x03, 0xff, 0x09, 0x04, 0xff,
+    0x09, 0x05, 0xff, 0x09, 0x06, 0x07, 0x0a, 0x02, 0xfe, 0x0a, 0x03, 0xff, 0x0a, 0x04, 0xff, 0x0a, 0x05, 0xff, 0x0a, 0x06, 0x07, 0x0b, 0x02, 0xfe,
+    0x0b, 0x03, 0xff, 0x0b, 0x04, 0xff, 0x0b, 0x05, 0xff, 0x0b, 0x06, 0x0f, 0x0c, 0x02, 0xfe, 0x0c, 0x03, 0xff, 0x0c, 0x04, 0xff, 0x0c, 0x05, 0xff,
+    0x0c, 0x06, 0x3f, 0x0d, 0x02, 0xfe, 0x0d, 0x03, 0xff, 0x0d, 0x04, 0xff, 0x0d, 0x05, 0xff, 0x0d, 0x06, 0x7f, 0x0e, 0x01, 0xc0, 0x0e, 0x02, 0xff,
+    0x0e, 0x03, 0xff, 0x0e, 0x04, 0xff, 0x0e, 0x05, 0xff, 0x0e, 0x06, 0x7f, 0x0f, 0x01, 0xf0, 0x0f, 0x02, 0xff, 0x0f, 0x03, 0xff, 0x0f, 0x04, 0xff,
+    0x0f, 0x05, 0xff, 0x0f, 0x06, 0xff, 0x10, 0x01, 0xfc, 0x10, 0x02, 0xff, 0x10, 0x03, 0xff, 0x10, 0x04, 0xff, 0x10, 0x05, 0xff, 0x10, 0x06, 0xff,
+    0x11, 0x01, 0xfe, 0x11, 0x02, 0xff, 0x11, 0x03, 0xff, 0x11, 0x04, 0xff, 0x11, 0x05, 0xff, 0x11, 0x06, 0xff, 0x12, 0x01, 0xfe, 0x12, 0x02, 0xff,
+    0x12, 0x03, 0xff, 0x12, 0x04, 0xff, 0x12, 0x05, 0xff, 0x12, 0x06, 0x7f, 0x13, 0x01, 0xff, 0x13, 0x02, 0xff, 0x13, 0x03, 0xff, 0x13, 0x04, 0xff,
+    0x13, 0x05, 0xff, 0x13, 0x06, 0x7f, 0x14, 0x01, 0xff, 0x14, 0x02, 0xff, 0x14, 0x03, 0xff, 0x14, 0x04, 0xff, 0x14, 0x05, 0xff, 0x14, 0x06, 0x3f,
+    0x15, 0x01, 0xff, 0x15, 0x02, 0xff, 0x15, 0x03, 0xff, 0x15, 0x04, 0xff, 0x15, 0x05, 0xff, 0x15, 0x06, 0x0f, 0x16, 0x01, 0xff, 0x16, 0x02, 0xff,
+    0x16, 0x03, 0xff, 0x16, 0x04, 0xff, 0x16, 0x05, 0xff, 0x16, 0x06, 0x01, 0x17, 0x01, 0xff, 0x17, 0x02, 0xff, 0x17, 0x03, 0xff, 0x17, 0x04, 0xff,
+    0x17, 0x05, 0xff, 0x17, 0x06, 0x01, 0x18, 0x01, 0xff, 0x18, 0x02, 0xff, 0x18, 0x03, 0xff, 0x18, 0x04, 0xff, 0x18, 0x05, 0xff, 0x18, 0x06, 0x01,
+    0x19, 0x01, 0xfe, 0x19, 0x02, 0xff, 0x19, 0x03, 0xff, 0x19, 0x04, 0xff, 0x19, 0x05, 0xff, 0x19, 0x06, 0x01, 0x1a, 0x01, 0xfe, 0x1a, 0x02, 0xff,
+    0x1a, 0x03, 0xff, 0x1a, 0x04, 0xff, 0x1a, 0x05, 0xff, 0x1b, 0x01, 0xfc, 0x1b, 0x02, 0xff, 0x1b, 0x03, 0xff, 0x1b, 0x04, 0xff, 0x1b, 0x05, 0xff,
+    0x1c, 0x01, 0xf8, 0x1c, 0x02, 0xff, 0x1c, 0x03, 0xff, 0x1c, 0x04, 0xff, 0x1c, 0x05, 0x7f, 0x1d, 0x01, 0xe0, 0x1d, 0x02, 0xff, 0x1d, 0x03, 0xff,
+    0x1d, 0x04, 0xff, 0x1d, 0x05, 0x1f, 0x1e, 0x02, 0xe0, 0x1e, 0x03, 0xff,
+};
+static const uint16_t thunderstorm_starts[] PROGMEM = {0, 0, 30, 30, 180};
+static const Animation thunderstorm_animation = {4, thunderstorm_starts, thunderstorm_deltas};
+
+//snow1: 8 frames, 302 deltas, 936 bytes of flash
+static const uint8_t snow1_deltas[] PROGMEM = {
+    0x1f, 0x01, 0x40, 0x1f, 0x02, 0x04, 0x1f, 0x03, 0x40, 0x1f, 0x04, 0x82, 0x1f, 0x05, 0x08, 0x20, 0x01, 0x50, 0x20, 0x02, 0x01, 0x20, 0x03, 0x81,
+    0x20, 0x04, 0x0a, 0x20, 0x05, 0x2a, 0x21, 0x01, 0x50, 0x21, 0x02, 0x41, 0x21, 0x03, 0x85, 0x21, 0x04, 0x0a, 0x21, 0x05, 0x2a, 0x22, 0x01, 0x50,
+    0x22, 0x02, 0x41, 0x22, 0x03, 0x85, 0x22, 0x04, 0x0a, 0x22, 0x05, 0x2a, 0x23, 0x01, 0x50, 0x23, 0x02, 0x41, 0x23, 0x03, 0x85, 0x23, 0x04, 0x0a,
+    0x23, 0x05, 0x2a, 0x24, 0x01, 0x40, 0x24, 0x02, 0x40, 0x24, 0x03, 0x05, 0x24, 0x04, 0x02, 0x24, 0x05, 0x08, 0x25, 0x02, 0x04, 0x25, 0x03, 0x41,
+    0x25, 0x04, 0x80, 0x26, 0x02, 0x15, 0x26, 0x03, 0x50, 0x26, 0x04, 0xa1, 0x26, 0x05, 0x02, 0x27, 0x02, 0x15, 0x27, 0x03, 0x50, 0x27, 0x04, 0xa1,
+    0x27, 0x05, 0x02, 0x28, 0x02, 0x15, 0x28, 0x03, 0x50, 0x28, 0x04, 0xa1, 0x28, 0x05, 0x02, 0x29, 0x02, 0x15, 0x29, 0x03, 0x50, 0x29, 0x04, 0xa1,
+    0x29, 0x05, 0x02, 0x1f, 0x01, 0x40, 0x1f, 0x02, 0x11, 0x1f, 0x03, 0x10, 0x1f, 0x04, 0x23, 0x1f, 0x05, 0x0a, 0x20, 0x01, 0x10, 0x20, 0x02, 0x05,
+    0x20, 0x03, 0xc1, 0x20, 0x04, 0x88, 0x20, 0x05, 0x22, 0x21, 0x02, 0x40, 0x21, 0x03, 0x04, 0x24, 0x01, 0x10, 0x24, 0x02, 0x01, 0x24, 0x03, 0x80,
+    0x24, 0x04, 0x08, 0x24, 0x05, 0x22, 0x25, 0x01, 0x40, 0x25, 0x02, 0x44, 0x25, 0x03, 0x44, 0x25, 0x04, 0x82, 0x25, 0x05, 0x08, 0x26, 0x02, 0x11,
+    0x26, 0x03, 0x11, 0x26, 0x04, 0x21, 0x26, 0x05, 0x02, 0x1f, 0x01, 0x40, 0x1f, 0x02, 0x11, 0x1f, 0x03, 0x10, 0x1f, 0x04, 0x23, 0x1f, 0x05, 0x0a,
+    0x20, 0x01, 0x10, 0x20, 0x02, 0x05, 0x20, 0x03, 0xc1, 0x20, 0x04, 0x88, 0x20, 0x05, 0x22, 0x21, 0x01, 0x40, 0x21, 0x02, 0x51, 0x21, 0x03, 0x14,
+    0x21, 0x04, 0x23, 0x21, 0x05, 0x0a, 0x22, 0x01, 0x10, 0x22, 0x02, 0x05, 0x22, 0x03, 0xc1, 0x22, 0x04, 0x88, 0x22, 0x05, 0x22, 0x23, 0x02, 0x40,
+    0x23, 0x03, 0x04, 0x24, 0x01, 0x10, 0x24, 0x02, 0x01, 0x24, 0x03, 0x80, 0x24, 0x04, 0x08, 0x24, 0x05, 0x22, 0x25, 0x01, 0x40, 0x25, 0x02, 0x44,
+    0x25, 0x03, 0x44, 0x25, 0x04, 0x82, 0x25, 0x05, 0x08, 0x26, 0x01, 0x10, 0x26, 0x02, 0x10, 0x26, 0x03, 0x91, 0x26, 0x04, 0x29, 0x26, 0x05, 0x20,
+    0x27, 0x01, 0x40, 0x27, 0x02, 0x44, 0x27, 0x03, 0x44, 0x27, 0x04, 0x82, 0x27, 0x05, 0x08, 0x28, 0x02, 0x11, 0x28, 0x03, 0x11, 0x28, 0x04, 0x21,
+    0x28, 0x05, 0x02, 0x1f, 0x01, 0x40, 0x1f, 0x02, 0x04, 0x1f, 0x03, 0x40, 0x1f, 0x04, 0x82, 0x1f, 0x05, 0x08, 0x20, 0x01, 0x10, 0x20, 0x02, 0x10,
+    0x20, 0x03, 0x91, 0x20, 0x04, 0x29, 0x20, 0x05, 0x20, 0x21, 0x01, 0x40, 0x21, 0x02, 0x44, 0x21, 0x03, 0x44, 0x21, 0x04, 0x82, 0x21, 0x05, 0x08,
+    0x22, 0x01, 0x10, 0x22, 0x02, 0x10, 0x22, 0x03, 0x91, 0x22, 0x04, 0x29, 0x22, 0x05, 0x20, 0x23, 0x01, 0x40, 0x23, 0x02, 0x44, 0x23, 0x03, 0x44,
+    0x23, 0x04, 0x82, 0x23, 0x05, 0x08, 0x24, 0x01, 0x40, 0x24, 0x03, 0x01, 0x24, 0x04, 0x02, 0x24, 0x05, 0x08, 0x25, 0x01, 0x10, 0x25, 0x02, 0x05,
+    0x25, 0x03, 0xc1, 0x25, 0x04, 0x88, 0x25, 0x05, 0x22, 0x26, 0x01, 0x40, 0x26, 0x02, 0x51, 0x26, 0x03, 0x14, 0x26, 0x04, 0x23, 0x26, 0x05, 0x0a,
+    0x27, 0x01, 0x10, 0x27, 0x02, 0x05, 0x27, 0x03, 0xc1, 0x27, 0x04, 0x88, 0x27, 0x05, 0x22, 0x28, 0x01, 0x40, 0x28, 0x02, 0x51, 0x28, 0x03, 0x14,
+    0x28, 0x04, 0x23, 0x28, 0x05, 0x0a, 0x29, 0x02, 0x04, 0x29, 0x03, 0x41, 0x29, 0x04, 0x80, 0x1f, 0x01, 0x40, 0x1f, 0x03, 0x01, 0x1f, 0x04, 0x02,
+    0x1f, 0x05, 0x08, 0x20, 0x01, 0x10, 0x20, 0x02, 0x05, 0x20, 0x03, 0xc1, 0x20, 0x04, 0x88, 0x20, 0x05, 0x22, 0x21, 0x01, 0x40, 0x21, 0x02, 0x51,
+    0x21, 0x03, 0x14, 0x21, 0x04, 0x23, 0x21, 0x05, 0x0a, 0x22, 0x01, 0x10, 0x22, 0x02, 0x05, 0x22, 0x03, 0xc1, 0x22, 0x04, 0x88, 0x22, 0x05, 0x22,
+    0x23, 0x01, 0x40, 0x23, 0x02, 0x51, 0x23, 0x03, 0x14, 0x23, 0x04, 0x23, 0x23, 0x05, 0x0a, 0x24, 0x02, 0x04, 0x24, 0x03, 0x41, 0x24, 0x04, 0x80,
+    0x25, 0x01, 0x40, 0x25, 0x02, 0x04, 0x25, 0x03, 0x40, 0x25, 0x04, 0x82, 0x25, 0x05, 0x08, 0x26, 0x01, 0x10, 0x26, 0x02, 0x10, 0x26, 0x03, 0x91,
+    0x26, 0x04, 0x29, 0x26, 0x05, 0x20, 0x27, 0x01, 0x40, 0x27, 0x02, 0x44, 0x27, 0x03, 0x44, 0x27, 0x04, 0x82, 0x27, 0x05, 0x08, 0x28, 0x01, 0x10,
+    0x28, 0x02, 0x10, 0x28, 0x03, 0x91, 0x28, 0x04, 0x29, 0x28, 0x05, 0x20, 0x29, 0x01, 0x40, 0x29, 0x02, 0x44, 0x29, 0x03, 0x44, 0x29, 0x04, 0x82,
+    0x29, 0x05, 0x08, 0x1f, 0x01, 0x50, 0x1f, 0x02, 0x01, 0x1f, 0x03, 0x81, 0x1f, 0x04, 0x0a, 0x1f, 0x05, 0x2a, 0x20, 0x01, 0x50, 0x20, 0x02, 0x41,
+    0x20, 0x03, 0x85, 0x20, 0x04, 0x0a, 0x20, 0x05, 0x2a, 0x21, 0x01, 0x40, 0x21, 0x02, 0x40, 0x21, 0x03, 0x05, 0x21, 0x04, 0x02, 0x21, 0x05, 0x08,
+    0x22, 0x01, 0x10, 0x22, 0x02, 0x05, 0x22, 0x03, 0xc1, 0x22, 0x04, 0x88, 0x22, 0x05, 0x22, 0x23, 0x01, 0x40, 0x23, 0x02, 0x51, 0x23, 0x03, 0x14,
+    0x23, 0x04, 0x23, 0x23, 0x05, 0x0a, 0x24, 0x02, 0x04, 0x24, 0x03, 0x41, 0x24, 0x04, 0x80, 0x25, 0x02, 0x15, 0x25, 0x03, 0x50, 0x25, 0x04, 0xa1,
+    0x25, 0x05, 0x02, 0x26, 0x02, 0x15, 0x26, 0x03, 0x50, 0x26, 0x04, 0xa1, 0x26, 0x05, 0x02, 0x27, 0x01, 0x40, 0x27, 0x02, 0x04, 0x27, 0x03, 0x40,
+    0x27, 0x04, 0x82, 0x27, 0x05, 0x08, 0x28, 0x01, 0x10, 0x28, 0x02, 0x10, 0x28, 0x03, 0x91, 0x28, 0x04, 0x29, 0x28, 0x05, 0x20, 0x29, 0x01, 0x40,
+    0x29, 0x02, 0x44, 0x29, 0x03, 0x44, 0x29, 0x04, 0x82, 0x29, 0x05, 0x08, 0x1f, 0x02, 0x40, 0x1f, 0x03, 0x04, 0x22, 0x01, 0x10, 0x22, 0x02, 0x01,
+    0x22, 0x03, 0x80, 0x22, 0x04, 0x08, 0x22, 0x05, 0x22, 0x23, 0x01, 0x40, 0x23, 0x02, 0x44, 0x23, 0x03, 0x44, 0x23, 0x04, 0x82, 0x23, 0x05, 0x08,
+    0x24, 0x02, 0x11, 0x24, 0x03, 0x11, 0x24, 0x04, 0x21, 0x24, 0x05, 0x02, 0x28, 0x01, 0x40, 0x28, 0x02, 0x11, 0x28, 0x03, 0x10, 0x28, 0x04, 0x23,
+    0x28, 0x05, 0x0a, 0x29, 0x01, 0x10, 0x29, 0x02, 0x05, 0x29, 0x03, 0xc1, 0x29, 0x04, 0x88, 0x29, 0x05, 0x22,
+};
+static const uint16_t snow1_starts[] PROGMEM = {0, 0, 49, 75, 121, 173, 225, 276, 302};
+static const Animation snow1_animation = {8, snow1_starts, snow1_deltas};
+
+//mist: 4 frames, 84 deltas, 274 bytes of flash
+static const uint8_t mist_deltas[] PROGMEM = {
+    0x05, 0x02, 0x20, 0x05, 0x04, 0x20, 0x06, 0x02, 0x20, 0x06, 0x04, 0x20, 0x0a, 0x01, 0x08, 0x0a, 0x05, 0x02, 0x0b, 0x01, 0x08, 0x0b, 0x05, 0x02,
+    0x0f, 0x02, 0x10, 0x0f, 0x06, 0x80, 0x10, 0x02, 0x10, 0x10, 0x06, 0x80, 0x14, 0x01, 0x01, 0x14, 0x05, 0x08, 0x15, 0x01, 0x01, 0x15, 0x05, 0x08,
+    0x19, 0x02, 0x02, 0x19, 0x06, 0x10, 0x1a, 0x02, 0x02, 0x1a, 0x06, 0x10, 0x1e, 0x01, 0x20, 0x1e, 0x06, 0x02, 0x1f, 0x01, 0x20, 0x1f, 0x06, 0x02,
+    0x23, 0x02, 0x10, 0x23, 0x05, 0x04, 0x24, 0x02, 0x10, 0x24, 0x05, 0x04, 0x05, 0x02, 0x30, 0x05, 0x04, 0x30, 0x06, 0x02, 0x30, 0x06, 0x04, 0x30,
+    0x0a, 0x01, 0x18, 0x0a, 0x05, 0x06, 0x0b, 0x01, 0x18, 0x0b, 0x05, 0x06, 0x0f, 0x02, 0x18, 0x0f, 0x06, 0xc0, 0x10, 0x02, 0x18, 0x10, 0x06, 0xc0,
+    0x14, 0x01, 0x03, 0x14, 0x05, 0x18, 0x15, 0x01, 0x03, 0x15, 0x05, 0x18, 0x19, 0x02, 0x03, 0x19, 0x06, 0x18, 0x1a, 0x02, 0x03, 0x1a, 0x06, 0x18,
+    0x1e, 0x01, 0x60, 0x1e, 0x06, 0x06, 0x1f, 0x01, 0x60, 0x1f, 0x06, 0x06, 0x23, 0x02, 0x18, 0x23, 0x05, 0x06, 0x24, 0x02, 0x18, 0x24, 0x05, 0x06,
+    0x05, 0x02, 0x20, 0x05, 0x04, 0x20, 0x06, 0x02, 0x20, 0x06, 0x04, 0x20, 0x0a, 0x01, 0x08, 0x0a, 0x05, 0x02, 0x0b, 0x01, 0x08, 0x0b, 0x05, 0x02,
+    0x0f, 0x02, 0x10, 0x0f, 0x06, 0x80, 0x10, 0x02, 0x10, 0x10, 0x06, 0x80, 0x14, 0x01, 0x01, 0x14, 0x05, 0x08, 0x15, 0x01, 0x01, 0x15, 0x05, 0x08,
+    0x19, 0x02, 0x02, 0x19, 0x06, 0x10, 0x1a, 0x02, 0x02, 0x1a, 0x06, 0x10, 0x1e, 0x01, 0x20, 0x1e, 0x06, 0x02, 0x1f, 0x01, 0x20, 0x1f, 0x06, 0x02,
+    0x23, 0x02, 0x10, 0x23, 0x05, 0x04, 0x24, 0x02, 0x10, 0x24, 0x05, 0x04,
+};
+static const uint16_t mist_starts[] PROGMEM = {0, 0, 28, 56, 84};
+static const Animation mist_animation = {4, mist_starts, mist_deltas};
+
+//total 6366 bytes of flash
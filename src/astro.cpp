@@ -0,0 +1,134 @@
+#include "astro.h"
+
+/*----(MACROS)----*/
+//angles are binary (2^32 = full turn), sines Q30
+#define ASTRO_J2000       946728000LL   //1.1.2000 12:00 UTC
+#define ASTRO_M0          4265488311UL  //mean anomaly at J2000 (357.5291°)
+#define ASTRO_M_RATE      8919168LL     //mean anomaly per second (0.98560028°/day, Q16)
+#define ASTRO_C1          22844454LL    //equation of center (1.9148°, 0.0200°, 0.0003°)
+#define ASTRO_C2          238609LL
+#define ASTRO_C3          3579LL
+#define ASTRO_PERIHELION  3375572280UL  //argument of perihelion + 180° (282.9372°)
+#define ASTRO_PERIHELION_RATE 426LL     //perihelion advance per second (1.72°/century, Q16)
+#define ASTRO_SIN_EPS     427116999LL   //sin of Earth's axial tilt (23.4397°)
+#define ASTRO_SIN_H0      -15610145LL   //sin of sunrise altitude (-0.833°)
+#define ASTRO_MOON_NEW    947182440LL   //new moon 6.1.2000 18:14 UTC
+#define ASTRO_MOON_MONTH  2551443LL     //mean synodic month (s)
+
+static AstroDay astro;
+static int32_t astro_latitude = 0;
+static int32_t astro_longitude = 0;
+
+//sine of binary angle (Q30), Taylor series of the first quarter (error below 1e-5)
+static int32_t sinTurn(uint32_t angle) {
+    uint32_t x = angle & 0x3FFFFFFF;
+    if (angle & 0x40000000) x = 0x40000000 - x;     //second and fourth quarter are mirrored
+    int64_t z = x;                                  //part of quarter (Q30)
+    int64_t z2 = z * z >> 30;
+    int64_t r = 172272;                             //(pi/2)^9 / 9!
+    r = -5026995 + (r * z2 >> 30);                  //-(pi/2)^7 / 7!
+    r = 85569306 + (r * z2 >> 30);                  //(pi/2)^5 / 5!
+    r = -693598668 + (r * z2 >> 30);                //-(pi/2)^3 / 3!
+    r = 1686629713 + (r * z2 >> 30);                //pi/2
+    r = r * z >> 30;
+    return (angle & 0x80000000) ? -r : r;
+}
+
+static int32_t cosTurn(uint32_t angle) {
+    return sinTurn(angle + 0x40000000);
+}
+
+//angle 0 - half turn with given cosine (Q30)
+static uint32_t acosTurn(int32_t value) {
+    uint32_t low = 0;
+    uint32_t high = 0x80000000;
+    while (high - low > 1) {
+        uint32_t middle = low + (high - low) / 2;
+        if (cosTurn(middle) > value) low = middle;
+        else high = middle;
+    }
+    return low;
+}
+
+static uint32_t isqrt(uint64_t value) {
+    uint64_t result = 0;
+    for (uint64_t bit = 1ULL << 62; bit; bit >>= 2) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else result >>= 1;
+    }
+    return result;
+}
+
+//declination and solar transit near time t (s since J2000), mean noon is start of the day
+static int64_t sunPosition(int64_t t, int64_t noon, int32_t &sin_d, int32_t &cos_d) {
+    uint32_t m = ASTRO_M0 + (uint32_t)(t * ASTRO_M_RATE >> 16);                     //mean anomaly
+    int32_t sin_m = sinTurn(m);
+    uint32_t lambda = m + ASTRO_PERIHELION + (uint32_t)(t * ASTRO_PERIHELION_RATE >> 16) + (uint32_t)((ASTRO_C1 * sin_m + ASTRO_C2 * sinTurn(2 * m) + ASTRO_C3 * sinTurn(3 * m)) >> 30);
+    sin_d = (int64_t)sinTurn(lambda) * ASTRO_SIN_EPS >> 30;
+    cos_d = isqrt((1ULL << 60) - (int64_t)sin_d * sin_d);
+    return noon + ((45792LL * sin_m - 59616LL * sinTurn(2 * lambda)) >> 30) / 100;  //equation of time
+}
+
+//sunrise (sign -1) or sunset (sign 1) in s since J2000, declination is refined at the time of the event
+//@return false when the sun does not cross the horizon (polar < 0 = below all day)
+static bool sunEvent(int64_t noon, int32_t sin_phi, int32_t cos_phi, int8_t sign, int64_t &event, int8_t &polar) {
+    int64_t t = noon;
+    for (uint8_t i = 0; i < 3; i++) {
+        int32_t sin_d, cos_d;
+        int64_t transit = sunPosition(t, noon, sin_d, cos_d);
+        int64_t num = ASTRO_SIN_H0 - ((int64_t)sin_phi * sin_d >> 30);
+        int64_t den = (int64_t)cos_phi * cos_d >> 30;
+        if (den <= 0 || num >= den || num <= -den) {
+            if (i) return true;             //sun touches horizon near the event, keep previous estimate
+            polar = (num > 0) ? -1 : 1;
+            return false;
+        }
+        int64_t half = (int64_t)acosTurn((num << 30) / den) * 86400 >> 32;    //half of the day (s)
+        t = event = transit + sign * half;
+    }
+    return true;
+}
+
+//sunrise equation for mean solar noon of the day
+static void computeSun(long day, int32_t latitude, int32_t longitude) {
+    int64_t noon = (int64_t)(day - 10957) * 86400 - (int64_t)longitude * 3 / 125;  //s since J2000
+    uint32_t phi = (uint32_t)((int64_t)latitude * 4294967296LL / 3600000);
+    int64_t rise, set;
+
+    astro.sunrise = astro.sunset = 0;
+    astro.polar = 0;
+    if (sunEvent(noon, sinTurn(phi), cosTurn(phi), -1, rise, astro.polar)
+        && sunEvent(noon, sinTurn(phi), cosTurn(phi), 1, set, astro.polar)) {
+        astro.sunrise = ASTRO_J2000 + rise;
+        astro.sunset = ASTRO_J2000 + set;
+    }
+}
+
+//phase of mean moon at noon of the day
+static void computeMoon(long day) {
+    int64_t age = ((int64_t)day * 86400 + 43200 - ASTRO_MOON_NEW) % ASTRO_MOON_MONTH;
+    if (age < 0) age += ASTRO_MOON_MONTH;
+    astro.moon_phase = (age * 8 + ASTRO_MOON_MONTH / 2) / ASTRO_MOON_MONTH % 8;
+    uint32_t angle = age * 4294967296LL / ASTRO_MOON_MONTH;
+    astro.moon_light = ((int64_t)(0x40000000 - cosTurn(angle)) * 100 + 0x40000000) >> 31;
+}
+
+const AstroDay &astroDay(uint32_t utc, long offset, int32_t latitude, int32_t longitude) {
+    long day = ((int64_t)utc + offset) / 86400;
+    if (day == astro.day && latitude == astro_latitude && longitude == astro_longitude) return astro;
+
+    computeSun(day, latitude, longitude);
+    computeMoon(day);
+    astro.day = day;
+    astro_latitude = latitude;
+    astro_longitude = longitude;
+    return astro;
+}
+
+bool astroIsDay(const AstroDay &day, uint32_t utc) {
+    if (day.polar) return day.polar > 0;
+    return utc >= day.sunrise && utc < day.sunset;
+}
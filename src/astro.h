@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(STRUCT)----*/
+//sun and moon of one local day
+typedef struct {
+    long day = -1;              //local day (days since 1.1.1970, -1 = not computed)
+    uint32_t sunrise = 0;       //UTC epoch (0 when the sun does not rise or set)
+    uint32_t sunset = 0;        //UTC epoch
+    int8_t polar = 0;           //1 = sun is up whole day, -1 = sun is down whole day
+    uint8_t moon_phase = 0;     //0-7 (0 = new moon, 2 = first quarter, 4 = full moon)
+    uint8_t moon_light = 0;     //illuminated part of the moon (%)
+} AstroDay;
+
+/*----(FUNCTIONS)----*/
+//Sunrise, sunset and moon phase in fixed point (no float math on the chip).
+//Sun uses the sunrise equation (upper limb with refraction, about a minute of error),
+//moon phase is computed from the mean synodic month (up to about half a day of error).
+
+/**
+ * Sun and moon of the local day containing utc. The result is cached,
+ * it is recomputed only for another day or location.
+ *
+ * @param offset local time offset (s)
+ * @param latitude north positive (1e-4 degree)
+ * @param longitude east positive (1e-4 degree)
+ */
+const AstroDay &astroDay(uint32_t utc, long offset, int32_t latitude, int32_t longitude);
+
+/**
+ * @return true if the sun is above horizon at utc (day computed by astroDay())
+ */
+bool astroIsDay(const AstroDay &day, uint32_t utc);
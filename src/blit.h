@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "display.h"
+
+/*----(FUNCTIONS)----*/
+//Direct drawing into full frame buffer of ST7920 rotated by U8G2_R2.
+//Display row y is buffer row (height - 1 - y) and display pixel x is bit (x % 8) of byte
+//(width/8 - 1 - x/8) of that row, so XBM rows (LSB = leftmost pixel) are copied with reversed
+//byte order but without any bit reversal.
+//Backends with vertical layout (Display::layout) draw bitmaps by u8g2 instead.
+
+/**
+ * @return byte with display pixels 0-7 of row y (bytes of following pixels are at lower addresses)
+ */
+inline uint8_t *blitRow(U8G2 &lcd, int y) {
+    uint8_t stride = lcd.getBufferTileWidth();
+    return lcd.getBufferPtr() + (lcd.getBufferTileHeight() * 8 - 1 - y) * stride + stride - 1;
+}
+
+/**
+ * Draw pixels of one row starting at x (bit 0 = pixel x, up to 24 pixels).
+ * Pixels in mask and not in bits are cleared, columns outside of the buffer are skipped.
+ */
+inline void blitBits(uint8_t *row, uint8_t columns, int x, uint32_t bits, uint32_t mask) {
+    int column = x >> 3;    //rounded down for negative x
+    uint8_t shift = x & 7;
+    bits <<= shift;
+    mask <<= shift;
+    for (; mask; column++, bits >>= 8, mask >>= 8) {
+        if ((uint8_t)mask && column >= 0 && column < columns) {
+            uint8_t *byte = row - column;
+            *byte = (*byte & ~(uint8_t)mask) | (uint8_t)bits;
+        }
+    }
+}
+
+/**
+ * Invert pixels of one row starting at x (bit 0 = pixel x, up to 24 pixels),
+ * columns outside of the buffer are skipped.
+ */
+inline void blitXor(uint8_t *row, uint8_t columns, int x, uint32_t bits) {
+    int column = x >> 3;
+    bits <<= x & 7;
+    for (; bits; column++, bits >>= 8) {
+        if ((uint8_t)bits && column >= 0 && column < columns) *(row - column) ^= (uint8_t)bits;
+    }
+}
+
+/**
+ * Draw XBM bitmap of fixed size like drawXBM() with solid bitmap mode and draw color 1
+ * (zero bits clear pixels). Rows are moved three bytes at a time in 32-bit shift register
+ * and written bytewise (rows are stored in reversed byte order, buffer may be unaligned).
+ */
+template <uint8_t W, uint8_t H>
+void blitXBM(U8G2 &lcd, int x, int y, const uint8_t *bits) {
+    if (Display::layout != DISPLAY_HORIZONTAL) {    //resolved at compile time
+        lcd.drawXBM(x, y, W, H, bits);
+        return;
+    }
+
+    constexpr uint8_t row_bytes = (W + 7) / 8;
+    const uint8_t columns = lcd.getBufferTileWidth();
+    const int height = lcd.getBufferTileHeight() * 8;
+    if (x >= columns * 8 || x + W <= 0) return;
+
+    for (uint8_t r = 0; r < H; r++, bits += row_bytes) {
+        if (y + r < 0) continue;
+        if (y + r >= height) break;
+        uint8_t *row = blitRow(lcd, y + r);
+
+        for (uint8_t i = 0; i < row_bytes; i += 3) {
+            uint32_t word = bits[i];
+            if (i + 1 < row_bytes) word |= (uint32_t)bits[i + 1] << 8;
+            if (i + 2 < row_bytes) word |= (uint32_t)bits[i + 2] << 16;
+            uint8_t pixels = (W - i*8 < 24) ? W - i*8 : 24;
+            uint32_t mask = (1UL << pixels) - 1;
+            blitBits(row, columns, x + i*8, word & mask, mask);
+        }
+    }
+}
+
+/**
+ * Copy pixels of rows y .. y + H - 1 starting at x = 0 into XBM bitmap W x H
+ * (drawing it by blitXBM() restores them, bits right of W are undefined)
+ */
+template <uint8_t W, uint8_t H>
+void blitCapture(U8G2 &lcd, int y, uint8_t *bits) {
+    constexpr uint8_t row_bytes = (W + 7) / 8;
+    for (uint8_t r = 0; r < H; r++, bits += row_bytes) {
+        const uint8_t *row = blitRow(lcd, y + r);
+        for (uint8_t i = 0; i < row_bytes; i++) bits[i] = row[-i];
+    }
+}
@@ -0,0 +1,164 @@
+#include "config.h"
+#include <EEPROM.h>
+#include "json_stream.h"
+
+static bool save_pending = false;
+static unsigned long save_timer = 0;
+
+static uint32_t crc32(const uint8_t *data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    while (length--) {
+        crc ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+//size of each stored layout (up to the first field of the next version, older layouts
+//may have tail padding that overlaps a later field)
+static constexpr uint16_t layout_size[CONFIG_VERSION + 1] = {
+    0,
+    offsetof(Config, timezone),     //version 1
+    offsetof(Config, power_save),   //version 2
+    offsetof(Config, latitude),     //version 3
+    sizeof(Config),                 //version 4
+};
+static_assert(layout_size[CONFIG_VERSION] == sizeof(Config), "add layout of new config version");
+
+static uint32_t configCrc(const Config &config, size_t size) {
+    return crc32((const uint8_t *)&config + CONFIG_HEADER_SIZE, size - CONFIG_HEADER_SIZE);
+}
+
+bool configLoad(Config &config, const Config &defaults) {
+    config = defaults;
+    config.magic   = CONFIG_MAGIC;
+    config.version = CONFIG_VERSION;
+    config.size    = sizeof(Config);
+    config.writes  = 0;
+
+    EEPROM.begin(sizeof(Config));
+    const Config *stored = (const Config *)EEPROM.getConstDataPtr();
+
+    //check stored image
+    if (stored->magic != CONFIG_MAGIC
+     || stored->size < CONFIG_HEADER_SIZE
+     || stored->size > sizeof(Config)
+     || stored->version < 1
+     || stored->version > CONFIG_VERSION
+     || stored->size < layout_size[stored->version]
+     || stored->crc != configCrc(*stored, stored->size)) {
+        return false;   //missing or broken, use defaults
+    }
+
+    //copy fields of stored version only, fields added later keep defaults
+    memcpy(&config, stored, layout_size[stored->version]);
+    config.version = CONFIG_VERSION;
+    config.size    = sizeof(Config);
+
+    //make sure everything is in range
+    for (uint8_t i = 0; i < CONFIG_MAX_CITIES; i++) config.cities[i][CONFIG_CITY_LEN - 1] = '\0';
+    config.ssid[sizeof(config.ssid) - 1] = '\0';
+    config.passw[sizeof(config.passw) - 1] = '\0';
+    config.mqtt_addr[sizeof(config.mqtt_addr) - 1] = '\0';
+    config.ntp_addr[sizeof(config.ntp_addr) - 1] = '\0';
+    config.device_name[sizeof(config.device_name) - 1] = '\0';
+    config.timezone[sizeof(config.timezone) - 1] = '\0';
+    if (config.city_count < 1 || config.city_count > CONFIG_MAX_CITIES) config.city_count = 1;
+    if (config.footer_time < 100) config.footer_time = defaults.footer_time;
+    if (config.screen_time < 100) config.screen_time = defaults.screen_time;
+    config.power_save = config.power_save ? 1 : 0;
+    config.latitude = constrain(config.latitude, -900000, 900000);
+    config.longitude = constrain(config.longitude, -1800000, 1800000);
+
+    if (stored->version != CONFIG_VERSION) configSave();  //store migrated layout
+    return true;
+}
+
+void configSave() {
+    save_pending = true;
+    save_timer = millis();
+}
+
+void configLoop(const Config &config) {
+    if (!save_pending || millis() - save_timer < CONFIG_SAVE_DELAY) return;
+    configWrite(config);
+}
+
+void configWrite(const Config &config) {
+    save_pending = false;
+
+    Config *stored = (Config *)EEPROM.getDataPtr();
+    uint16_t writes = (stored->magic == CONFIG_MAGIC) ? stored->writes : 0;
+
+    //skip the write if nothing changed
+    uint32_t crc = configCrc(config, sizeof(Config));
+    if (stored->magic == CONFIG_MAGIC && stored->version == CONFIG_VERSION && stored->size == sizeof(Config) && stored->crc == crc
+     && !memcmp((const uint8_t *)stored + CONFIG_HEADER_SIZE, (const uint8_t *)&config + CONFIG_HEADER_SIZE, sizeof(Config) - CONFIG_HEADER_SIZE)) {
+        return;
+    }
+
+    *stored = config;
+    stored->magic   = CONFIG_MAGIC;
+    stored->version = CONFIG_VERSION;
+    stored->size    = sizeof(Config);
+    stored->writes  = writes + 1;
+    stored->crc     = crc;
+    EEPROM.commit();
+}
+
+
+/*----(PARSING)----*/
+typedef struct {
+    Config *config;
+    bool cities;    //cities array was in the message
+    bool invalid;   //some value did not fit its field
+} ConfigParser;
+
+//copy string value, cut values (password, server name...) are rejected instead of stored
+static void copyValue(ConfigParser &parser, JsonStream &json, char *field, const char *value, size_t size) {
+    if (json.truncated() || strlcpy(field, value, size) >= size) parser.invalid = true;
+}
+
+static void onConfigValue(JsonStream &json, const char *value, void *ctx) {
+    ConfigParser &parser = *(ConfigParser *)ctx;
+    Config &config = *parser.config;
+
+    if      (json.match("ssid"))             copyValue(parser, json, config.ssid, value, sizeof(config.ssid));
+    else if (json.match("passw"))            copyValue(parser, json, config.passw, value, sizeof(config.passw));
+    else if (json.match("mqtt_addr"))        copyValue(parser, json, config.mqtt_addr, value, sizeof(config.mqtt_addr));
+    else if (json.match("ntp_addr"))         copyValue(parser, json, config.ntp_addr, value, sizeof(config.ntp_addr));
+    else if (json.match("device_name"))      copyValue(parser, json, config.device_name, value, sizeof(config.device_name));
+    else if (json.match("time_offset"))      config.time_offset      = atol(value);
+    else if (json.match("timezone"))         copyValue(parser, json, config.timezone, value, sizeof(config.timezone));
+    else if (json.match("temp_calibration")) {
+        long calibration = parseFixed(value, 3);
+        if (calibration <= 0 || calibration > CONFIG_MAX_CALIBRATION) parser.invalid = true;
+        else config.temp_calibration = calibration;
+    }
+    else if (json.match("footer_time"))      config.footer_time      = constrain(atol(value), 100, 60000);
+    else if (json.match("screen_time"))      config.screen_time      = constrain(atol(value), 100, 60000);
+    else if (json.match("power_save"))       config.power_save       = !strcmp(value, "true") || atol(value) != 0;
+    else if (json.match("latitude"))         config.latitude         = constrain(parseFixed(value, 4), -900000, 900000);
+    else if (json.match("longitude"))        config.longitude        = constrain(parseFixed(value, 4), -1800000, 1800000);
+    else if (json.match("cities.#")) {
+        int index = json.index(1);
+        if (index >= CONFIG_MAX_CITIES) return;
+        if (!parser.cities) config.city_count = 0;  //replace the whole list
+        parser.cities = true;
+        copyValue(parser, json, config.cities[index], value, CONFIG_CITY_LEN);
+        config.city_count = index + 1;
+    }
+}
+
+bool configParse(Config &config, const byte *payload, unsigned int length) {
+    Config parsed = config;
+    ConfigParser parser = {&parsed, false, false};
+
+    JsonStream json(onConfigValue, &parser);
+    json.feed(payload, length);
+    if (!json.done() || parser.invalid) return false;
+    if (parsed.city_count == 0) return false;
+
+    config = parsed;
+    return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(MACROS)----*/
+#define CONFIG_MAGIC      0x5743    //"WC"
+#define CONFIG_VERSION    4         //bump when adding fields (only append new fields to Config, add layout to config.cpp)
+#define CONFIG_MAX_CITIES 8
+#define CONFIG_CITY_LEN   24
+#define CONFIG_SAVE_DELAY 10000     //ms to wait for more changes before writing flash
+#define CONFIG_MAX_CALIBRATION 10000    //largest temp_calibration (1/1000, fits int16_t)
+
+/*----(STRUCT)----*/
+//stored configuration (binary image in flash)
+typedef struct {
+    //header
+    uint16_t magic;
+    uint8_t  version;           //version of stored layout
+    uint8_t  reserved;
+    uint16_t size;              //size of stored layout
+    uint16_t writes;            //number of flash writes (for wear statistics)
+    uint32_t crc;               //crc32 of everything after header
+
+    //version 1
+    char     ssid[33];
+    char     passw[65];
+    char     mqtt_addr[40];
+    char     ntp_addr[40];
+    char     device_name[32];
+    char     cities[CONFIG_MAX_CITIES][CONFIG_CITY_LEN];
+    uint8_t  city_count;
+    int32_t  time_offset;       //s
+    int16_t  temp_calibration;  //inside temperature multiplier (1/1000)
+    uint16_t footer_time;       //footer update period (ms)
+    uint16_t screen_time;       //screen change period (ms)
+
+    //version 2
+    char     timezone[48];      //POSIX TZ rules (time_offset is used when empty)
+
+    //version 3
+    uint8_t  power_save;        //sleep between scheduled tasks (0/1)
+
+    //version 4
+    int32_t  latitude;          //north positive (1e-4 degree, 0 with longitude 0 = not set)
+    int32_t  longitude;         //east positive (1e-4 degree)
+} Config;
+
+#define CONFIG_HEADER_SIZE offsetof(Config, ssid)
+
+/*----(FUNCTIONS)----*/
+/**
+ * Load configuration from flash. Older layouts are migrated, broken or missing
+ * configuration is replaced by defaults.
+ *
+ * @return true if stored configuration was used
+ */
+bool configLoad(Config &config, const Config &defaults);
+
+/**
+ * Schedule write of configuration to flash (configuration passed to configLoop() is
+ * written once there were no changes for CONFIG_SAVE_DELAY ms, only if it differs)
+ */
+void configSave();
+
+/**
+ * Write configuration to flash now (only if it differs)
+ */
+void configWrite(const Config &config);
+
+/**
+ * Write scheduled configuration. Call it from main loop.
+ */
+void configLoop(const Config &config);
+
+/**
+ * Update configuration from json like {"ssid":"...","cities":["A","B"],"timezone":"CET-1CEST,M3.5.0,M10.5.0/3"}
+ *
+ * @return true if the json was valid and all strings fit their fields (configuration is unchanged otherwise)
+ */
+bool configParse(Config &config, const byte *payload, unsigned int length);
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+/*----(MACROS)----*/
+//display backends, select with build flag (e.g. -D DISPLAY=DISPLAY_SSD1306)
+#define DISPLAY_ST7920  1   //ST7920 128x64 on hardware SPI
+#define DISPLAY_SSD1306 2   //SSD1306 128x64 on hardware I2C
+#define DISPLAY_SH1106  3   //SH1106 128x64 on hardware I2C
+
+#ifndef DISPLAY
+#define DISPLAY DISPLAY_ST7920
+#endif
+
+/*----(TYPES)----*/
+//byte layout of the full frame buffer
+enum DisplayLayout : uint8_t {
+    DISPLAY_HORIZONTAL, //byte = 8 pixels of one line (ST7920)
+    DISPLAY_VERTICAL    //byte = 8 lines of one pixel column (SSD1306, SH1106)
+};
+
+//Compile-time description of a display backend.
+//Drawing code and flush read these constants, so unused paths are removed by the compiler
+//and nothing is dispatched at runtime. Only full buffer (_F_) devices are supported.
+template <class Device, DisplayLayout LAYOUT, bool ROW_FLUSH>
+struct DisplayBackend {
+    typedef Device Lcd;                                 //u8g2 device class
+    static constexpr DisplayLayout layout = LAYOUT;     //frame buffer layout
+    static constexpr bool row_flush = ROW_FLUSH;        //only whole tile rows can be sent
+};
+
+#if DISPLAY == DISPLAY_SSD1306
+//vertical tiles can be sent one by one, only changed columns of a row are sent
+typedef DisplayBackend<U8G2_SSD1306_128X64_NONAME_F_HW_I2C, DISPLAY_VERTICAL, false> Display;
+#define DISPLAY_ARGS U8G2_R2, U8X8_PIN_NONE
+#elif DISPLAY == DISPLAY_SH1106
+typedef DisplayBackend<U8G2_SH1106_128X64_NONAME_F_HW_I2C, DISPLAY_VERTICAL, false> Display;
+#define DISPLAY_ARGS U8G2_R2, U8X8_PIN_NONE
+#else
+//updateDisplayArea() of horizontal layout is correct only for whole rows
+typedef DisplayBackend<U8G2_ST7920_128X64_F_HW_SPI, DISPLAY_HORIZONTAL, true> Display;
+#define DISPLAY_ARGS U8G2_R2, 15, 16    //rotation, cs, reset
+#endif
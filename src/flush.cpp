@@ -0,0 +1,76 @@
+#include "flush.h"
+
+static uint8_t flush_snapshot[FLUSH_BUFFER];    //content sent (or being sent) to display
+static uint8_t flush_pending = 0;               //tile rows of snapshot still to send (bit per row)
+static uint8_t flush_first[8];                  //first changed tile of every pending row
+static uint8_t flush_tiles[8];                  //number of changed tiles of every pending row
+static bool flush_valid = false;                //snapshot matches the display
+static uint32_t flush_tile_us = 0;              //transfer time of one tile (last sent row)
+
+uint16_t flushStart(U8G2 &lcd) {
+    uint8_t *buffer = lcd.getBufferPtr();
+    uint8_t rows = lcd.getBufferTileHeight();
+    uint8_t columns = lcd.getBufferTileWidth();
+    uint16_t row_size = columns * 8;
+    if (rows > 8 || rows * row_size > FLUSH_BUFFER) {   //does not fit the snapshot, send it whole
+        lcd.sendBuffer();
+        return rows * row_size;
+    }
+
+    uint16_t bytes = 0;
+    for (uint8_t row = 0; row < rows; row++) {
+        uint8_t *live = buffer + row * row_size;
+        uint8_t *shown = flush_snapshot + row * row_size;
+        uint8_t first = 0;
+        uint8_t last = columns - 1;
+        if (flush_valid) {
+            if (!memcmp(shown, live, row_size)) continue;
+            if (!Display::row_flush) {  //vertical tiles, narrow the row to changed tiles
+                while (!memcmp(shown + first*8, live + first*8, 8)) first++;
+                while (!memcmp(shown + last*8, live + last*8, 8)) last--;
+            }
+        }
+        uint16_t size = (last - first + 1) * 8;
+        memcpy(shown + first*8, live + first*8, size);
+        uint8_t counted = 0;                //tiles of the row still waiting in running flush
+        if (flush_pending & (1 << row)) {   //send span covering both
+            counted = flush_tiles[row];
+            first = min(first, flush_first[row]);
+            last = max(last, (uint8_t)(flush_first[row] + flush_tiles[row] - 1));
+        }
+        flush_first[row] = first;
+        flush_tiles[row] = last - first + 1;
+        flush_pending |= 1 << row;
+        bytes += (flush_tiles[row] - counted) * 8;
+    }
+    flush_valid = true;
+    return bytes;
+}
+
+void flushStep(U8G2 &lcd, uint32_t budget_us) {
+    u8g2_t *u8g2 = lcd.getU8g2();
+    uint8_t *buffer = u8g2->tile_buf_ptr;
+    uint32_t start = micros();
+    bool sent = false;
+
+    u8g2->tile_buf_ptr = flush_snapshot;    //send from the snapshot
+    for (uint8_t row = 0; flush_pending; row++) {
+        if (!(flush_pending & (1 << row))) continue;
+        if (sent && micros() - start + flush_tile_us * flush_tiles[row] > budget_us) break;    //row would not fit
+
+        uint32_t row_start = micros();
+        lcd.updateDisplayArea(flush_first[row], row, flush_tiles[row], 1);
+        flush_tile_us = (micros() - row_start) / flush_tiles[row];
+        flush_pending &= ~(1 << row);
+        sent = true;
+    }
+    u8g2->tile_buf_ptr = buffer;
+}
+
+bool flushBusy() {
+    return flush_pending != 0;
+}
+
+void flushInvalidate() {
+    flush_valid = false;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "display.h"
+
+/*----(MACROS)----*/
+#define FLUSH_BUFFER 1024   //frame snapshot size (128x64 full buffer)
+
+/*----(FUNCTIONS)----*/
+//Display flush in tile row chunks spread over loop iterations.
+//Rows changed since last flush are copied into a snapshot which is then sent, so drawing into
+//the buffer during the flush never shows half drawn frame. Unchanged rows are not sent at all,
+//backends with vertical tiles (Display::row_flush false) send only the changed tiles of a row.
+//Rows are in buffer order (updateDisplayArea is not rotated).
+
+/**
+ * Snapshot changed rows of current frame and start sending them. When previous flush is still
+ * running, its rows waiting to be sent are replaced by the current frame.
+ *
+ * @return bytes that will be sent
+ */
+uint16_t flushStart(U8G2 &lcd);
+
+/**
+ * Send rows of the snapshot while time budget lasts (at least one row)
+ */
+void flushStep(U8G2 &lcd, uint32_t budget_us);
+
+/**
+ * @return true while snapshot is being sent
+ */
+bool flushBusy();
+
+/**
+ * Display was drawn directly (sendBuffer), treat all rows as changed
+ */
+void flushInvalidate();
@@ -0,0 +1,106 @@
+#include "format.h"
+
+static const long powers[] = {1, 10, 100, 1000, 10000};
+
+//write unsigned number, return end of string
+static char *writeNumber(char *buf, unsigned long value, uint8_t min_digits) {
+    char digits[10];
+    uint8_t count = 0;
+    do {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while (value || count < min_digits);
+    while (count) *buf++ = digits[--count];
+    *buf = '\0';
+    return buf;
+}
+
+//write fixed point number, return end of string
+static char *writeFixed(char *buf, long value, uint8_t decimals) {
+    if (value < 0) {
+        *buf++ = '-';
+        value = -value;
+    }
+    buf = writeNumber(buf, value / powers[decimals], 1);
+    if (decimals) {
+        *buf++ = '.';
+        buf = writeNumber(buf, value % powers[decimals], decimals);
+    }
+    return buf;
+}
+
+char *formatInt(char *buf, long value) {
+    writeFixed(buf, value, 0);
+    return buf;
+}
+
+char *formatFixed(char *buf, long value, uint8_t decimals) {
+    writeFixed(buf, value, decimals);
+    return buf;
+}
+
+long roundFixed(long value, uint8_t decimals) {
+    long half = powers[decimals] / 2;
+    return (value < 0) ? -((-value + half) / powers[decimals]) : (value + half) / powers[decimals];
+}
+
+long kelvinToDeci(long centi_kelvin) {
+    return roundFixed(centi_kelvin - 27315, 1);
+}
+
+char *formatTemperature(char *buf, long deci_celsius) {
+    char *end = writeFixed(buf, deci_celsius, 1);
+    strcpy(end, "\xb0");
+    return buf;
+}
+
+char *formatPressure(char *buf, long hpa) {
+    char *end = writeFixed(buf, hpa, 3);
+    strcpy(end, "bar");
+    return buf;
+}
+
+char *formatSpeed(char *buf, long deci_mps) {
+    char *end = writeFixed(buf, deci_mps, 1);
+    strcpy(end, "m/s");
+    return buf;
+}
+
+char *formatPercent(char *buf, int percent) {
+    char *end = writeFixed(buf, percent, 0);
+    strcpy(end, "%");
+    return buf;
+}
+
+char *formatTwoDigits(char *buf, int value) {
+    writeNumber(buf, value, 2);
+    return buf;
+}
+
+char *formatClock(char *buf, int hours, int minutes, int seconds) {
+    char *end = writeNumber(buf, hours, 2);
+    *end++ = ':';
+    end = writeNumber(end, minutes, 2);
+    *end++ = ':';
+    writeNumber(end, seconds, 2);
+    return buf;
+}
+
+char *formatDate(char *buf, int day, int month, int year) {
+    char *end = writeNumber(buf, day, 2);
+    *end++ = '.';
+    end = writeNumber(end, month, 2);
+    *end++ = '.';
+    writeNumber(end, year, 4);
+    return buf;
+}
+
+size_t clampLength(size_t used, size_t len) {
+    if (used < len) return used;
+    return len ? len - 1 : 0;
+}
+
+size_t appendText(char *buf, size_t len, size_t used, const char *text) {
+    if (used >= len) return clampLength(used, len);
+    return clampLength(used + strlcpy(buf + used, text, len - used), len);
+}
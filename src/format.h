@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(FUNCTIONS)----*/
+//Allocation free number formatting (no float printf) into caller's buffer.
+//Every function returns the buffer so it can be passed directly to draw functions.
+
+/**
+ * Integer ("-12")
+ */
+char *formatInt(char *buf, long value);
+
+/**
+ * Fixed point value with given decimals (formatFixed(buf, -125, 1) -> "-12.5")
+ */
+char *formatFixed(char *buf, long value, uint8_t decimals);
+
+/**
+ * Fixed point value rounded to whole number (roundFixed(-125, 1) -> -13)
+ */
+long roundFixed(long value, uint8_t decimals);
+
+/**
+ * Temperature in 0.01K to 0.1°C rounded half away from zero (kelvinToDeci(29642) -> 233)
+ */
+long kelvinToDeci(long centi_kelvin);
+
+/**
+ * Temperature from 0.1°C ("-12.5°")
+ */
+char *formatTemperature(char *buf, long deci_celsius);
+
+/**
+ * Pressure from hPa ("1.013bar")
+ */
+char *formatPressure(char *buf, long hpa);
+
+/**
+ * Wind speed from 0.1m/s ("3.4m/s")
+ */
+char *formatSpeed(char *buf, long deci_mps);
+
+/**
+ * Percentage ("65%")
+ */
+char *formatPercent(char *buf, int percent);
+
+/**
+ * Clock field with leading zero ("05")
+ */
+char *formatTwoDigits(char *buf, int value);
+
+/**
+ * Time ("hh:mm:ss")
+ */
+char *formatClock(char *buf, int hours, int minutes, int seconds);
+
+/**
+ * Date ("dd.mm.yyyy")
+ */
+char *formatDate(char *buf, int day, int month, int year);
+
+/**
+ * Length of text written by a series of snprintf calls (used is the sum of their results,
+ * it exceeds the buffer when the text was cut)
+ *
+ * @return used clamped to len - 1 (0 for empty buffer)
+ */
+size_t clampLength(size_t used, size_t len);
+
+/**
+ * Append text to buffer of size len holding used characters (cut if it does not fit)
+ *
+ * @return new length (at most len - 1)
+ */
+size_t appendText(char *buf, size_t len, size_t used, const char *text);
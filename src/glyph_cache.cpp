@@ -0,0 +1,56 @@
+#include "glyph_cache.h"
+#include "blit.h"
+
+static char     cache_chars[GLYPH_CACHE_CHARS + 1] = "";
+static uint16_t cache_rows[GLYPH_CACHE_CHARS][GLYPH_CACHE_HEIGHT];  //bit 0 = leftmost pixel
+static uint8_t  cache_advance = 0;  //glyph advance (0 = cache not usable)
+static uint8_t  cache_height = 0;
+static int8_t   cache_ascent = 0;
+
+bool glyphCacheBegin(U8G2 &lcd, const uint8_t *font, const char *chars) {
+    cache_advance = 0;
+    if (Display::layout != DISPLAY_HORIZONTAL) return false;   //rows are captured from horizontal buffer
+    lcd.setFont(font);
+    int advance = lcd.getStrWidth("0");
+    int height = lcd.getAscent() - lcd.getDescent();
+    if (strlen(chars) > GLYPH_CACHE_CHARS || advance > GLYPH_CACHE_WIDTH || lcd.getMaxCharWidth() > GLYPH_CACHE_WIDTH
+        || height > GLYPH_CACHE_HEIGHT) return false;
+
+    strcpy(cache_chars, chars);
+    cache_height = height;
+    cache_ascent = lcd.getAscent();
+    for (uint8_t i = 0; cache_chars[i]; i++) {
+        lcd.clearBuffer();
+        lcd.drawGlyph(0, cache_ascent, cache_chars[i]);
+        for (uint8_t row = 0; row < cache_height; row++) {
+            const uint8_t *line = blitRow(lcd, row);
+            cache_rows[i][row] = line[0] | (line[-1] << 8);     //pixels 0-15
+        }
+    }
+    lcd.clearBuffer();
+    cache_advance = advance;
+    return true;
+}
+
+int glyphCacheWidth(const char *text) {
+    return strlen(text) * cache_advance;
+}
+
+bool glyphCacheDraw(U8G2 &lcd, int x, int y, const char *text) {
+    if (!cache_advance) return false;
+    for (const char *c = text; *c; c++) {
+        if (!strchr(cache_chars, *c)) return false;
+    }
+
+    uint8_t columns = lcd.getBufferTileWidth();
+    int height = lcd.getBufferTileHeight() * 8;
+    int top = y - cache_ascent;
+    for (; *text; text++, x += cache_advance) {
+        const uint16_t *rows = cache_rows[strchr(cache_chars, *text) - cache_chars];
+        for (uint8_t row = 0; row < cache_height; row++) {
+            if (!rows[row] || top + row < 0 || top + row >= height) continue;
+            blitBits(blitRow(lcd, top + row), columns, x, rows[row], rows[row]);   //transparent like fonts
+        }
+    }
+    return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+/*----(MACROS)----*/
+#define GLYPH_CACHE_CHARS  12   //max number of cached characters
+#define GLYPH_CACHE_HEIGHT 24   //max glyph height (rows)
+#define GLYPH_CACHE_WIDTH  16   //max glyph width (pixels, captured rows are 16 bits)
+
+/*----(FUNCTIONS)----*/
+//Pre-rendered glyphs for text drawn every second (clock digits).
+//Glyphs are rendered once by u8g2 and captured from the frame buffer, drawing then ORs
+//the rows straight into the buffer instead of decoding the compressed font again.
+//Expects full buffer with horizontal layout (ST7920) rotated by U8G2_R2, other backends draw by u8g2.
+
+/**
+ * Render and capture characters of monospace font (clears the buffer)
+ *
+ * @return false when font does not fit the cache (drawing then always fails)
+ */
+bool glyphCacheBegin(U8G2 &lcd, const uint8_t *font, const char *chars);
+
+/**
+ * @return width of text drawn from the cache
+ */
+int glyphCacheWidth(const char *text);
+
+/**
+ * Draw text from the cache, y is baseline as with drawStr()
+ *
+ * @return false when some character is not cached (nothing is drawn)
+ */
+bool glyphCacheDraw(U8G2 &lcd, int x, int y, const char *text);
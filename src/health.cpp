@@ -0,0 +1,35 @@
+#include "health.h"
+#include "format.h"
+
+static HealthSample health_history[HEALTH_HISTORY];
+static uint8_t health_count = 0;    //number of samples in history
+static uint8_t health_next = 0;     //position of next sample
+static uint16_t health_min_heap  = 0xFFFF;
+static uint16_t health_min_block = 0xFFFF;
+
+void healthSample() {
+    HealthSample &sample = health_history[health_next];
+    sample.uptime        = millis() / 1000;
+    sample.free_heap     = ESP.getFreeHeap();
+    sample.max_block     = ESP.getMaxFreeBlockSize();
+    sample.fragmentation = ESP.getHeapFragmentation();
+    sample.stack_free    = ESP.getFreeContStack();
+
+    if (sample.free_heap < health_min_heap)  health_min_heap  = sample.free_heap;
+    if (sample.max_block < health_min_block) health_min_block = sample.max_block;
+
+    health_next = (health_next + 1) % HEALTH_HISTORY;
+    if (health_count < HEALTH_HISTORY) health_count++;
+}
+
+size_t healthReport(char *buf, size_t len) {
+    size_t used = snprintf(buf, len, "reset %s\nmin %u %u %u\n", ESP.getResetReason().c_str(),
+                           health_min_heap, health_min_block, (unsigned)ESP.getFreeContStack());
+
+    for (uint8_t i = 0; i < health_count && used < len; i++) {
+        const HealthSample &sample = health_history[(health_next + HEALTH_HISTORY - health_count + i) % HEALTH_HISTORY];
+        used += snprintf(buf + used, len - used, "%u %u %u %u %u\n", (unsigned)sample.uptime,
+                         sample.free_heap, sample.max_block, sample.fragmentation, sample.stack_free);
+    }
+    return clampLength(used, len);
+}
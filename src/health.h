@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(MACROS)----*/
+#define HEALTH_HISTORY 16   //number of kept samples
+
+/*----(STRUCT)----*/
+typedef struct {
+    uint32_t uptime;        //s
+    uint16_t free_heap;     //bytes
+    uint16_t max_block;     //largest free block (bytes)
+    uint8_t  fragmentation; //%
+    uint16_t stack_free;    //lowest free stack since boot (bytes)
+} HealthSample;
+
+/*----(FUNCTIONS)----*/
+/**
+ * Take heap and stack sample into history
+ */
+void healthSample();
+
+/**
+ * Write report of kept history with reset reason and lowest values since boot.
+ * First line "reset <reason>", second "min <free_heap> <max_block> <stack_free>" (heap values
+ * are the lowest samples, dips between samples are not seen; stack is the high-water mark),
+ * then line per sample "uptime free_heap max_block fragmentation stack_free" (oldest first).
+ *
+ * @return length of the report
+ */
+size_t healthReport(char *buf, size_t len);
@@ -0,0 +1,314 @@
+#include "json_stream.h"
+
+JsonStream::JsonStream(ValueCallback callback, void *ctx) {
+    _callback = callback;
+    _ctx = ctx;
+    reset();
+}
+
+void JsonStream::reset() {
+    _state = JSON_VALUE;
+    _depth = 0;
+    _len = 0;
+}
+
+bool JsonStream::done() {
+    return _state == JSON_DONE;
+}
+
+bool JsonStream::failed() {
+    return _state == JSON_FAILED;
+}
+
+uint8_t JsonStream::depth() {
+    return _depth;
+}
+
+int JsonStream::index(uint8_t level) {
+    if (level >= _depth || level >= JSON_MAX_DEPTH || _levels[level].object) return -1;
+    return _levels[level].index;
+}
+
+bool JsonStream::isString() {
+    return _is_string;
+}
+
+bool JsonStream::truncated() {
+    return _truncated;
+}
+
+bool JsonStream::match(const char *pattern) {
+    uint8_t level = 0;
+    while (*pattern) {
+        if (level >= _depth || level >= JSON_MAX_DEPTH) return false;
+        const JsonLevel &current = _levels[level];
+
+        //get pattern segment
+        const char *end = strchr(pattern, '.');
+        size_t len = end ? (size_t)(end - pattern) : strlen(pattern);
+
+        if (current.object) {
+            if (strncmp(current.key, pattern, len) || current.key[len] != '\0') return false;
+        }
+        else if (!(len == 1 && *pattern == '#')) {
+            if (*pattern < '0' || *pattern > '9' || atoi(pattern) != current.index) return false;
+        }
+
+        pattern += len;
+        if (*pattern == '.') pattern++;
+        level++;
+    }
+    return level == _depth;
+}
+
+void JsonStream::append(char c) {
+    if (_len < JSON_VALUE_LEN - 1) _value[_len++] = c;
+    else _truncated = true;
+}
+
+void JsonStream::push(bool object) {
+    if (_depth >= 32) {     //way too deep for anything we expect
+        _state = JSON_FAILED;
+        return;
+    }
+    if (_depth < JSON_MAX_DEPTH) {
+        _levels[_depth].object = object;
+        _levels[_depth].key[0] = '\0';
+        _levels[_depth].index = 0;
+    }
+    if (object) _objects |=  (1UL << _depth);
+    else        _objects &= ~(1UL << _depth);
+    _depth++;
+    _state = object ? JSON_OBJECT_START : JSON_ARRAY_START;
+}
+
+void JsonStream::pop(char c) {
+    bool object = _objects & (1UL << (_depth - 1));
+    if (object != (c == '}')) {
+        _state = JSON_FAILED;
+        return;
+    }
+    _depth--;
+    _state = (_depth == 0) ? JSON_DONE : JSON_AFTER;
+}
+
+void JsonStream::value() {
+    //do not leave half of utf-8 character at the end of truncated string
+    if (_len == JSON_VALUE_LEN - 1) {
+        int lead = _len - 1;
+        while (lead > 0 && (_value[lead] & 0xC0) == 0x80) lead--;
+        if (_value[lead] & 0x80) {
+            int needed = ((_value[lead] & 0xE0) == 0xC0) ? 2 : ((_value[lead] & 0xF0) == 0xE0) ? 3 : 4;
+            if (lead + needed > _len) _len = lead;
+        }
+    }
+    _value[_len] = '\0';
+
+    if (_depth <= JSON_MAX_DEPTH) _callback(*this, _value, _ctx);
+    _state = (_depth == 0) ? JSON_DONE : JSON_AFTER;
+}
+
+//handle character outside of strings and literals
+void JsonStream::next(char c) {
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r') return;
+
+    switch (_state) {
+        case JSON_OBJECT_START:
+            if (c == '}') {
+                pop(c);
+                return;
+            }
+            //fallthrough
+        case JSON_KEY:
+            if (c == '"') {
+                _len = 0;
+                _is_key = true;
+                _state = JSON_STRING;
+            }
+            else _state = JSON_FAILED;
+            return;
+
+        case JSON_COLON:
+            _state = (c == ':') ? JSON_VALUE : JSON_FAILED;
+            return;
+
+        case JSON_ARRAY_START:
+            if (c == ']') {
+                pop(c);
+                return;
+            }
+            //fallthrough
+        case JSON_VALUE:
+            _len = 0;
+            _truncated = false;
+            if      (c == '{') push(true);
+            else if (c == '[') push(false);
+            else if (c == '"') {
+                _is_key = false;
+                _is_string = true;
+                _state = JSON_STRING;
+            }
+            else if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n') {
+                _is_string = false;
+                append(c);
+                _state = JSON_LITERAL;
+            }
+            else _state = JSON_FAILED;
+            return;
+
+        case JSON_AFTER:
+            if (c == ',') {
+                if (_objects & (1UL << (_depth - 1))) _state = JSON_KEY;
+                else {
+                    if (_depth <= JSON_MAX_DEPTH) _levels[_depth - 1].index++;
+                    _state = JSON_VALUE;
+                }
+            }
+            else if (c == '}' || c == ']') pop(c);
+            else _state = JSON_FAILED;
+            return;
+
+        default:
+            _state = JSON_FAILED;
+            return;
+    }
+}
+
+void JsonStream::feed(char c) {
+    switch (_state) {
+        case JSON_DONE:
+        case JSON_FAILED:
+            return;
+
+        case JSON_STRING:
+            if (c == '"') {
+                if (_is_key) {
+                    if (_depth <= JSON_MAX_DEPTH) {
+                        uint8_t len = (_len < JSON_KEY_LEN) ? _len : JSON_KEY_LEN - 1;
+                        memcpy(_levels[_depth - 1].key, _value, len);
+                        _levels[_depth - 1].key[len] = '\0';
+                    }
+                    _state = JSON_COLON;
+                }
+                else value();
+            }
+            else if (c == '\\') _state = JSON_ESCAPE;
+            else append(c);
+            return;
+
+        case JSON_ESCAPE:
+            _state = JSON_STRING;
+            switch (c) {
+                case 'n': append('\n'); break;
+                case 't': append('\t'); break;
+                case 'r': append('\r'); break;
+                case 'b': append('\b'); break;
+                case 'f': append('\f'); break;
+                case 'u':
+                    _unicode = 0;
+                    _unicode_len = 0;
+                    _state = JSON_UNICODE;
+                    break;
+                default:  append(c);    break;  // " \ /
+            }
+            return;
+
+        case JSON_UNICODE:
+            _unicode <<= 4;
+            if      (c >= '0' && c <= '9') _unicode |= c - '0';
+            else if (c >= 'a' && c <= 'f') _unicode |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') _unicode |= c - 'A' + 10;
+            else {
+                _state = JSON_FAILED;
+                return;
+            }
+            if (++_unicode_len < 4) return;
+
+            //encode as utf-8 (surrogate pairs are not supported)
+            if (_unicode < 0x80) append(_unicode);
+            else if (_unicode < 0x800) {
+                if (_len + 2 < JSON_VALUE_LEN) {
+                    append(0xC0 | (_unicode >> 6));
+                    append(0x80 | (_unicode & 0x3F));
+                }
+                else _truncated = true;
+            }
+            else if (_unicode >= 0xD800 && _unicode < 0xE000) append('?');
+            else if (_len + 3 < JSON_VALUE_LEN) {
+                append(0xE0 | (_unicode >> 12));
+                append(0x80 | ((_unicode >> 6) & 0x3F));
+                append(0x80 | (_unicode & 0x3F));
+            }
+            else _truncated = true;
+            _state = JSON_STRING;
+            return;
+
+        case JSON_LITERAL:
+            if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '.' || c == '-' || c == '+') {
+                append(c);
+                return;
+            }
+            value();
+            if (_state == JSON_DONE) return;
+            break;  //handle delimiter
+
+        default:
+            break;
+    }
+
+    next(c);
+}
+
+void JsonStream::feed(const byte *data, unsigned int length) {
+    for (unsigned int i = 0; i < length; i++) feed((char)data[i]);
+}
+
+
+long parseFixed(const char *value, uint8_t decimals) {
+    bool negative = (*value == '-');
+    if (negative || *value == '+') value++;
+
+    long result = 0;
+    int shift = decimals;   //power of 10 to apply to result
+    bool fraction = false;
+
+    //mantissa (only first 9 digits are used)
+    for (; *value; value++) {
+        if (*value == '.') fraction = true;
+        else if (*value >= '0' && *value <= '9') {
+            if (result < 100000000L) {
+                result = result * 10 + (*value - '0');
+                if (fraction) shift--;
+            }
+            else if (!fraction) shift++;
+        }
+        else break;
+    }
+
+    //exponent (read only up to 3 digits, more would only saturate or round to zero)
+    if (*value == 'e' || *value == 'E') {
+        value++;
+        bool negative_exponent = (*value == '-');
+        if (negative_exponent || *value == '+') value++;
+        int exponent = 0;
+        for (; *value >= '0' && *value <= '9'; value++) {
+            if (exponent < 100) exponent = exponent * 10 + (*value - '0');
+        }
+        shift += negative_exponent ? -exponent : exponent;
+    }
+
+    //scale to required decimals (10 steps saturate any non-zero result)
+    shift = constrain(shift, -20, 20);
+    if (shift > 0) {
+        while (shift-- > 0) result = (result > 214748364L) ? 2147483647L : result * 10;
+    }
+    else if (shift < 0) {
+        if (shift < -10) result = 0;
+        else {
+            while (++shift < 0) result /= 10;
+            result = (result + 5) / 10;  //round half away from zero
+        }
+    }
+
+    return negative ? -result : result;
+}
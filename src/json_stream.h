@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(MACROS)----*/
+#define JSON_MAX_DEPTH 6    //deeper values are skipped
+#define JSON_KEY_LEN   20   //longer keys are truncated (fits "temp_calibration")
+#define JSON_VALUE_LEN 65   //longer values are truncated (fits 64 character WPA2 key)
+
+/*----(STRUCT)----*/
+//one level of the current json path
+typedef struct {
+    bool object;                //object or array
+    char key[JSON_KEY_LEN];     //current key (objects)
+    int index;                  //current index (arrays)
+} JsonLevel;
+
+/*----(CLASS)----*/
+//Incremental (SAX style) json parser.
+//Data can be fed in any chunks, every scalar value is reported to the callback
+//together with its path, so nothing but the current path is ever stored.
+class JsonStream {
+  public:
+    typedef void (*ValueCallback)(JsonStream &json, const char *value, void *ctx);
+
+    JsonStream(ValueCallback callback, void *ctx = NULL);
+
+    /**
+     * Prepare for a new document
+     */
+    void reset();
+
+    /**
+     * Parse next part of the document
+     */
+    void feed(char c);
+    void feed(const byte *data, unsigned int length);
+
+    /**
+     * @return true when the whole document was parsed
+     */
+    bool done();
+
+    /**
+     * @return true when the document is not valid json
+     */
+    bool failed();
+
+    /**
+     * Check current path of a value against pattern like "daily.#.temp.day"
+     * (keys separated by '.', '#' matches any array index)
+     */
+    bool match(const char *pattern);
+
+    /**
+     * @return number of levels in current path
+     */
+    uint8_t depth();
+
+    /**
+     * @return array index of given level in current path
+     */
+    int index(uint8_t level);
+
+    /**
+     * @return true if the reported value was a string (not number/bool/null)
+     */
+    bool isString();
+
+    /**
+     * @return true if the reported value did not fit JSON_VALUE_LEN and was cut
+     */
+    bool truncated();
+
+  private:
+    enum State : uint8_t {
+        JSON_VALUE,         //expecting value
+        JSON_OBJECT_START,  //after '{'
+        JSON_ARRAY_START,   //after '['
+        JSON_KEY,           //expecting key
+        JSON_COLON,         //expecting ':'
+        JSON_STRING,        //inside string
+        JSON_ESCAPE,        //after '\' in string
+        JSON_UNICODE,       //inside \uXXXX
+        JSON_LITERAL,       //inside number/true/false/null
+        JSON_AFTER,         //after value
+        JSON_DONE,
+        JSON_FAILED
+    };
+
+    ValueCallback _callback;
+    void *_ctx;
+
+    State    _state;
+    bool     _is_key;
+    bool     _is_string;
+    bool     _truncated;                //current value was cut
+    uint8_t  _depth;                    //real depth (may be above JSON_MAX_DEPTH)
+    uint32_t _objects;                  //object/array bit for every level
+    JsonLevel _levels[JSON_MAX_DEPTH];
+
+    char     _value[JSON_VALUE_LEN];    //current string/literal
+    uint8_t  _len;
+    uint16_t _unicode;                  //\uXXXX value
+    uint8_t  _unicode_len;
+
+    void append(char c);
+    void push(bool object);
+    void pop(char c);
+    void value();
+    void next(char c);
+};
+
+/**
+ * Convert decimal number to fixed point integer with given decimals ("12.345", 2 -> 1235)
+ */
+long parseFixed(const char *value, uint8_t decimals);
@@ -0,0 +1,70 @@
+#include "locale_pack.h"
+
+#if LOCALE == LOCALE_CS
+#include "locales/cs.h"
+#elif LOCALE == LOCALE_DE
+#include "locales/de.h"
+#else
+#include "locales/en.h"
+#endif
+
+/*----(TEXTS)----*/
+static constexpr char locale_weekdays[7][16] PROGMEM = {LOCALE_WEEKDAYS};
+static constexpr char locale_weekdays_short[7][8] PROGMEM = {LOCALE_WEEKDAYS_SHORT};
+static constexpr char locale_labels[LOCALE_LABELS][LOCALE_TEXT_LEN] PROGMEM = {LOCALE_LABEL_TEXTS};
+
+static const uint8_t locale_weekday_widths[7] = {
+    textWidth(locale_weekdays[0], FONT_6X12_ADVANCE), textWidth(locale_weekdays[1], FONT_6X12_ADVANCE),
+    textWidth(locale_weekdays[2], FONT_6X12_ADVANCE), textWidth(locale_weekdays[3], FONT_6X12_ADVANCE),
+    textWidth(locale_weekdays[4], FONT_6X12_ADVANCE), textWidth(locale_weekdays[5], FONT_6X12_ADVANCE),
+    textWidth(locale_weekdays[6], FONT_6X12_ADVANCE)
+};
+static const uint8_t locale_label_widths[LOCALE_LABELS] = {
+    textWidth(locale_labels[LOCALE_UPDATING], FONT_6X12_ADVANCE), textWidth(locale_labels[LOCALE_DONE], FONT_6X12_ADVANCE),
+    textWidth(locale_labels[LOCALE_FAILED], FONT_6X12_ADVANCE), textWidth(locale_labels[LOCALE_CONNECTING], FONT_6X12_ADVANCE)
+};
+
+/*----(CHECKS)----*/
+//all texts fit their place
+template <size_t N, size_t L>
+constexpr bool textsFit(const char (&texts)[N][L], uint8_t advance, int width, size_t i = 0) {
+    return i == N || (textWidth(texts[i], advance) <= width && textsFit(texts, advance, width, i + 1));
+}
+
+//no character above U+00FF (fonts with Latin-1 only)
+constexpr bool textLatin1(const char *text) {
+    return !*text || ((uint8_t)*text < 0xC4 && textLatin1(text + 1));
+}
+
+template <size_t N, size_t L>
+constexpr bool textsLatin1(const char (&texts)[N][L], size_t i = 0) {
+    return i == N || (textLatin1(texts[i]) && textsLatin1(texts, i + 1));
+}
+
+static_assert(textsFit(locale_weekdays, FONT_6X12_ADVANCE, LOCALE_MAX_WIDTH), "weekday name is too wide");
+static_assert(textsFit(locale_labels, FONT_6X12_ADVANCE, LOCALE_MAX_WIDTH), "label is too wide");
+static_assert(textsFit(locale_weekdays_short, FONT_PROFONT10_ADVANCE, 15), "short weekday name does not fit forecast column");
+static_assert(textsLatin1(locale_weekdays_short), "short weekday names are drawn by Latin-1 font");
+
+/*----(FUNCTIONS)----*/
+uint8_t localeWeekday(char *buf, uint8_t day) {
+    strncpy_P(buf, locale_weekdays[day % 7], LOCALE_TEXT_LEN);
+    return locale_weekday_widths[day % 7];
+}
+
+void localeWeekdayShort(char *buf, uint8_t day) {
+    strncpy_P(buf, locale_weekdays_short[day % 7], LOCALE_TEXT_LEN);
+}
+
+uint8_t localeLabel(char *buf, LocaleLabel label) {
+    strncpy_P(buf, locale_labels[label], LOCALE_TEXT_LEN);
+    return locale_label_widths[label];
+}
+
+int stringWidth(const char *text, uint8_t advance) {
+    int width = 0;
+    for (; *text; text++) {
+        if (((uint8_t)*text & 0xC0) != 0x80) width += advance;   //continuation bytes have no glyph
+    }
+    return width;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(MACROS)----*/
+//locale packs (src/locales), select with build flag (e.g. -D LOCALE=LOCALE_CS)
+#define LOCALE_EN 1     //English
+#define LOCALE_CS 2     //Czech
+#define LOCALE_DE 3     //German
+
+#ifndef LOCALE
+#define LOCALE LOCALE_EN
+#endif
+
+#define LOCALE_TEXT_LEN  32     //buffer for any locale text (UTF-8, terminated)
+#define LOCALE_MAX_WIDTH 128    //texts are checked to fit the display at compile time
+
+//glyph advance of monospace fonts used for locale texts (pixels)
+#define FONT_6X12_ADVANCE      6    //u8g2_font_6x12_te (weekdays, labels)
+#define FONT_PROFONT10_ADVANCE 5    //u8g2_font_profont10_tf (short weekdays, Latin-1 only)
+#define FONT_PROFONT15_ADVANCE 7    //u8g2_font_profont15_tn (date)
+#define FONT_PROFONT22_ADVANCE 11   //u8g2_font_profont22_tn (clock)
+
+/*----(ENUMS)----*/
+//labels of a locale pack
+enum LocaleLabel : uint8_t {
+    LOCALE_UPDATING,    //OTA update started
+    LOCALE_DONE,        //OTA update finished
+    LOCALE_FAILED,      //OTA update failed
+    LOCALE_CONNECTING,  //connecting to wifi
+    LOCALE_LABELS
+};
+
+/*----(FUNCTIONS)----*/
+//Texts of the selected locale pack are stored in flash together with their widths computed
+//by the compiler, so centering needs no font decoding. Texts are UTF-8 (draw by drawUTF8()).
+
+/**
+ * @return width of UTF-8 text in monospace font with given glyph advance
+ */
+constexpr int textWidth(const char *text, uint8_t advance) {
+    return !*text ? 0 : (((uint8_t)*text & 0xC0) == 0x80 ? 0 : advance) + textWidth(text + 1, advance);
+}
+
+/**
+ * Width of UTF-8 text computed at run time (textWidth() is for constants, its recursion unrolled
+ * over a small buffer reads past its end)
+ *
+ * @return width of UTF-8 text in monospace font with given glyph advance
+ */
+int stringWidth(const char *text, uint8_t advance);
+
+/**
+ * Copy weekday name (0 = Sunday) from flash into buf (LOCALE_TEXT_LEN)
+ *
+ * @return width of the name in weekday font (6x12)
+ */
+uint8_t localeWeekday(char *buf, uint8_t day);
+
+/**
+ * Copy short weekday name (0 = Sunday) from flash into buf (LOCALE_TEXT_LEN)
+ */
+void localeWeekdayShort(char *buf, uint8_t day);
+
+/**
+ * Copy label from flash into buf (LOCALE_TEXT_LEN)
+ *
+ * @return width of the label in label font (6x12)
+ */
+uint8_t localeLabel(char *buf, LocaleLabel label);
@@ -0,0 +1,4 @@
+//Czech (weekdays and labels are drawn by 6x12_te, short weekdays by profont10_tf - Latin-1 only, so no "Č")
+#define LOCALE_WEEKDAYS       "Neděle", "Pondělí", "Úterý", "Středa", "Čtvrtek", "Pátek", "Sobota"
+#define LOCALE_WEEKDAYS_SHORT "NE", "PO", "ÚT", "ST", "CT", "PÁ", "SO"
+#define LOCALE_LABEL_TEXTS    "Probíhá aktualizace", "Hotovo", "Chyba", "Připojování k WiFi"
@@ -0,0 +1,4 @@
+//German (weekdays and labels are drawn by 6x12_te, short weekdays by profont10_tf - Latin-1 only)
+#define LOCALE_WEEKDAYS       "Sonntag", "Montag", "Dienstag", "Mittwoch", "Donnerstag", "Freitag", "Samstag"
+#define LOCALE_WEEKDAYS_SHORT "SO", "MO", "DI", "MI", "DO", "FR", "SA"
+#define LOCALE_LABEL_TEXTS    "Aktualisierung läuft", "Fertig", "Fehler", "Verbinde mit WLAN"
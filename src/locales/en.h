@@ -0,0 +1,4 @@
+//English (weekdays and labels are drawn by 6x12_te, short weekdays by profont10_tf - Latin-1 only)
+#define LOCALE_WEEKDAYS       "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"
+#define LOCALE_WEEKDAYS_SHORT "SU", "MO", "TU", "WE", "TH", "FR", "SA"
+#define LOCALE_LABEL_TEXTS    "Update in progress", "Done", "Failed", "Connecting to WiFi"
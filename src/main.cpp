@@ -3,19 +3,68 @@
 #include <NTPClient.h>          //ntp client
 #include <ESP8266WiFi.h>        //esp wifi client
 #include <PubSubClient.h>       //mqqt client
-#include <ArduinoJson.h>        //json parsing for weather data
 #include <U8g2lib.h>            //lcd
 #include <Adafruit_Sensor.h>    //sensor
 #include <Adafruit_AM2320.h>
 #include <ArduinoOTA.h>         //OTA
 #include "weather_icons.h"      //icons
+#include "json_stream.h"        //json parsing for weather data
+#include "config.h"             //runtime configuration
+#include "timezone.h"           //time zone rules
+#include "profiler.h"           //loop timing metrics
+#include "health.h"             //heap and stack monitoring
+#include "trace.h"              //event trace surviving resets
+#include "format.h"             //number formatting
+#include "glyph_cache.h"        //pre-rendered clock digits
+#include "blit.h"               //fast bitmap drawing
+#include "render.h"             //redrawing of changed widgets
+#include "power.h"              //sleeping between scheduled tasks
+#include "display.h"            //display backend selection
+#include "flush.h"              //display flush in chunks
+#include "animations.h"         //animated weather icons
+#include "locale_pack.h"        //texts of selected language
+#include "astro.h"              //sunrise, sunset and moon phase
+#if __has_include(<font_subset.h>)
+#include <font_subset.h>        //icon fonts cut to the drawn glyphs (tools/font_subset.py)
+#define FONT_WEATHER_ICONS font_weather_icons
+#define FONT_WWW_ICONS     font_www_icons
+#else
+#define FONT_WEATHER_ICONS u8g2_font_open_iconic_weather_1x_t
+#define FONT_WWW_ICONS     u8g2_font_open_iconic_www_1x_t
+#endif
 
 /*----(MACROS)----*/
 #define SECOND 1000
 #define MINUTE 60000
 #define HOUR 3600000
 
-#define LEN(x) sizeof(x) / sizeof(x[0])
+#define LEN(x) (sizeof(x) / sizeof(x[0]))
+
+#define MQTT_BUFFER 512         //mqtt buffer for control messages (weather data are streamed to the parser)
+#define WEATHER_STALE HOUR*2    //request new weather data when older than this
+#define WEATHER_GRACE SECOND*5  //wait for retained weather data before requesting it
+#define INSIDE_STALE MINUTE     //inside temperature is marked when the sensor has not answered for this long
+#define WEATHER_JITTER SECOND*20//random request delay (spreads requests of stations rebooted together)
+#define DAILY_COUNT 8           //days of daily forecast (today and next 7 days)
+#define DAILY_NIGHT 0x80        //night icon bit of DailyData.icon
+#define HOURLY_COUNT 24         //hours in precipitation chart
+#define MINUTELY_COUNT 60       //minutes in precipitation chart
+#define SCREEN_COUNT 4          //number of rotating screens
+#define ALERT_SCREEN SCREEN_COUNT   //alert screen (after the rotating screens while the city has an active alert)
+#define DELTA_BUFFER 512        //patches of one delta message (field, index and value text, about 8 bytes each)
+#define ALERT_COUNT 2           //alerts stored per city (later ones are dropped)
+#define ALERT_EVENT_LEN 32      //alert name (truncated)
+#define ALERT_TEXT_LEN  48      //start of alert description (truncated)
+#define ALERT_FLUSH_BUDGET 30000   //us of display transfer per loop iteration for a new alert (whole frame at once)
+#define METRICS_PERIOD MINUTE   //loop timing metrics publish period
+#define HEALTH_PERIOD MINUTE    //heap and stack sample period (history is published with metrics)
+#define FLUSH_BUDGET 4000       //us of display transfer per loop iteration (at least one tile row is sent)
+#define FORECAST_COLUMN 43      //forecast day column width (with separator line)
+#define FORECAST_HEIGHT 54      //forecast day column height
+#define FORECAST_FRAME 100      //ms per forecast scroll frame
+#define FORECAST_PAUSE SECOND/2 //forecast does not scroll right after screen change and before the next one
+#define DAY_CONTRAST 255        //display contrast by day and at night (ST7920 has no contrast control)
+#define NIGHT_CONTRAST 16
 
 #define LCD_WIDTH 128
 #define LCD_HEIGHT 64
@@ -23,67 +72,343 @@
                                    u8g2.drawBox(x, y, w, h);\
                                    u8g2.setDrawColor(1)\
 
+/*----(ENUMS)----*/
+//weather record fields (compact ids of delta messages)
+enum WeatherField : uint8_t {
+    FIELD_DT = 1,       //current.dt
+    FIELD_TEMP,         //current.temp
+    FIELD_HUMIDITY,     //current.humidity
+    FIELD_PRESSURE,     //current.pressure
+    FIELD_WIND_SPEED,   //current.wind_speed
+    FIELD_UVI,          //current.uvi
+    FIELD_ICON,         //current.weather.0.icon
+    FIELD_DAY_TEMP,     //daily.#.temp.day
+    FIELD_NIGHT_TEMP,   //daily.#.temp.night
+    FIELD_DAY_UVI,      //daily.#.uvi
+    FIELD_DAY_ICON,     //daily.#.weather.0.icon
+    FIELD_HOUR_TEMP,    //hourly.#.temp
+    FIELD_HOUR_POP,     //hourly.#.pop
+    FIELD_HOUR_RAIN,    //hourly.#.rain.1h or hourly.#.snow.1h
+    FIELD_MINUTE_RAIN,  //minutely.#.precipitation
+    FIELD_DAY_DT        //daily.#.dt
+};
+
 /*----(STRUCT)----*/
+//fixed point values converted once while parsing (no float math on the chip)
 typedef struct {
-    float day_temp = 0.0;
-    float night_temp = 0.0;
-    float temp = 0.0;
-    int humidity = 0;
-    float uvi = 0.0;
-    float pressure = 0.0;
-    float wind_speed = 0.0;
-    String icon = "";
+    int16_t day_temp = 0;       //0.1°C
+    int16_t night_temp = 0;     //0.1°C
+    int16_t temp = 0;           //0.1°C
+    uint8_t humidity = 0;       //%
+    uint16_t uvi = 0;           //0.01
+    uint16_t pressure = 0;      //hPa
+    uint16_t wind_speed = 0;    //0.1m/s
+    char icon[4] = "";          //icon code ("01d")
 } DayData;
 
+//one day of daily forecast (12 bytes)
+typedef struct {
+    uint32_t dt = 0;            //time of the forecast (UTC epoch, 0 = no data)
+    int16_t day_temp = 0;       //0.1°C
+    int16_t night_temp = 0;     //0.1°C
+    uint16_t uvi = 0;           //0.01
+    uint8_t icon = 0;           //icon number (iconType), DAILY_NIGHT for night icon
+} DailyData;
+
+//weather alert (alerts.#)
+typedef struct {
+    uint32_t start = 0;         //UTC epoch
+    uint32_t end = 0;           //UTC epoch (expired alerts are not shown, 0 = no alert)
+    char event[ALERT_EVENT_LEN] = "";       //alert name
+    char description[ALERT_TEXT_LEN] = "";  //start of description
+} WeatherAlert;
+
+typedef struct {
+    DayData current;            //current weather
+    DailyData daily[DAILY_COUNT];   //daily forecast as received (today first, labels come from dt)
+    int16_t hourly_temp[HOURLY_COUNT];  //hourly temperature (0.1°C)
+    uint8_t hourly_pop[HOURLY_COUNT];   //hourly precipitation probability (%)
+    uint8_t hourly_rain[HOURLY_COUNT];  //hourly precipitation (0.1mm)
+    uint8_t minutely[MINUTELY_COUNT];   //precipitation for next hour (0.1mm/h)
+    WeatherAlert alerts[ALERT_COUNT];   //alerts as received (not sent by deltas)
+    unsigned long updated = 0;  //last weather update (millis, 0 = never)
+    uint32_t dt = 0;            //time of the data (UTC epoch)
+    uint32_t version = 0;       //publisher's data version (deltas apply only to it, 0 = unknown)
+} CityWeather;
+
+typedef struct {
+    unsigned long requested = 0;    //last weather request (millis)
+    unsigned long due = 0;          //scheduled weather request (millis)
+    bool pending = false;           //request is scheduled
+    bool full = false;              //full data needed even when fresh (delta did not match)
+} WeatherRequest;
+
+//weather values formatted once per data update
+typedef struct {
+    int city = -1;                  //city of the text
+    unsigned long updated = 0;      //data update of the text
+    char temp[10];
+    char humidity[6];
+    char pressure[12];
+    char wind_speed[12];
+} WeatherText;
+
 /*----(CONSTANTS)----*/
 //EDIT HERE with your information
-const String ssid        = "***********";
-const String passw       = "***********";
-const String mqtt_addr   = "x.x.x.x";
-const String ntp_addr    = "x.x.x.x";
-const String city        = "Random City";
-const String device_name = "Device name";
+//(defaults only, they can be changed at runtime by json on devices/'device_name'/config)
+const char * default_ssid        = "***********";
+const char * default_passw       = "***********";
+const char * default_mqtt_addr   = "x.x.x.x";
+const char * default_ntp_addr    = "x.x.x.x,pool.ntp.org";   //up to 4 servers separated by ','
+const char * default_cities[]    = {"Random City"};   //add more cities to rotate through them
+const char * default_device_name = "Device name";
+const int    default_time_offset = 7200;            //s (used when timezone is empty)
+const char * default_timezone    = "CET-1CEST,M3.5.0,M10.5.0/3";   //POSIX TZ rules
+const int    default_temp_calibration = 950;        //inside temperature "calibration" (1/1000)
+const int    default_footer_time = SECOND;          //footer update period
+const int    default_screen_time = SECOND*4;        //screen change period
+const bool   default_power_save  = false;           //sleep between scheduled tasks (battery units)
+const long   default_latitude    = 0;               //1e-4 degree, north positive (0 with longitude 0 = icons by weather data, no night mode)
+const long   default_longitude   = 0;               //1e-4 degree, east positive
 
 /*----(VARIABLES)----*/
 //init
-//EDIT HERE for your specific 128x64 configuration
-U8G2_ST7920_128X64_F_HW_SPI u8g2(U8G2_R2, 15, 16);  //LCD config
+//EDIT HERE for your specific 128x64 configuration (controller is selected by DISPLAY build flag)
+Display::Lcd u8g2(DISPLAY_ARGS);                    //LCD config
 WiFiClient espClient;                               //create wificlient
 PubSubClient client(espClient);                     //setup mqtt client
 WiFiUDP ntpUDP;                                     //create wifiudp
-NTPClient time_client(ntpUDP, ntp_addr.c_str());    //setup time client width server on 192.168.1.1
+Config config;                                      //runtime configuration
+NTPClient time_client(ntpUDP);                      //setup time client (servers from config)
 Adafruit_AM2320 am2320 = Adafruit_AM2320();         //am2320 sensor
-
-//weekdays for time screen and forecast
-//EDIT HERE for your language
-char days_of_week[7][10] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
-char days_of_week_short[7][4] = {"SU", "MO", "TU", "WE", "TH", "FR", "SA"};
-
-bool startup = true;    //startup bool
-
-DayData curr_day;       //current day data storage
-DayData forecast[3];    //next 4 days forecast
-float inside_temp;      //inside temperature
-
-int screen = 0; //current screen to show
+Timezone time_zone;                                 //local time rules
+
+bool reconnect = false; //reconnect to mqtt (configuration change)
+bool wifi_trial = false;                    //try new credentials on next connect (stored once they work)
+char trial_ssid[sizeof(config.ssid)];       //new credentials
+char trial_passw[sizeof(config.passw)];
+
+//weather of the configured cities is allocated once at boot (about 470 bytes a city with its request), a
+//configuration with more cities is written to flash and restarts the station, so the heap is never
+//fragmented by city changes
+CityWeather *weather;               //weather data for each city
+WeatherRequest *requests;           //weather requests for each city
+uint8_t weather_slots = 0;          //cities with allocated weather
+WeatherText weather_text;           //formatted weather of current city
+int16_t inside_temp;                //inside temperature (0.1°C)
+unsigned long inside_updated = 0;   //time of last good sensor reading (0 = none yet)
+char inside_text[10];               //formatted inside temperature
+long time_offset = 0;               //current local time offset (s)
+char ntp_servers[sizeof(config.ntp_addr)];  //ntp server names (split config.ntp_addr)
+
+int screen = -1;    //shown screen (-1 before the first one)
+int city = 0;       //shown city
+long shown_minute = -1;  //minute shown by the widgets (local time)
+bool frame_pending = false; //frame was drawn but its flush did not start yet
+bool night = false;         //sun is below horizon (dimmed display, night icons, no icon animation)
+int alert_shown = 0;        //alert of shown city on the alert screen
+bool alert_urgent = false;  //new alert is being drawn and sent (pre-empts the running flush)
+
+//forecast screen
+uint8_t forecast_tiles[DAILY_COUNT - 1][FORECAST_HEIGHT * 6];  //pre-rendered day columns (XBM, 43x54)
+uint8_t forecast_index[DAILY_COUNT - 1];    //daily entries of shown days (after today)
+int forecast_days = 0;                      //number of shown days
+int forecast_offset = -1;                   //drawn scroll position (px, -1 = not drawn)
 
 //timers
 unsigned long screen_timer = 0;
 unsigned long footer_timer = 0;
+unsigned long frame_timer = 0;
 unsigned long sync_timer = 0;
+unsigned long metrics_timer = 0;
+unsigned long health_timer = 0;
 
 /*----(HELPER FUNCTIONS)----*/
-void drawCenteredString(char * text, int y) {
-    int width = u8g2.getStrWidth(text);
-    width = LCD_WIDTH/2 - width/2;
-    u8g2.drawStr(width, y, text);
+//set time zone rules from configuration
+void setTimezone() {
+    if (!config.timezone[0] || !time_zone.set(config.timezone)) time_zone.setOffset(config.time_offset);
+}
+
+//set ntp servers from configuration ("a,b,c")
+void setNtpServers() {
+    const char *names[NTP_MAX_SERVERS];
+    uint8_t count = 0;
+
+    strlcpy(ntp_servers, config.ntp_addr, sizeof(ntp_servers));
+    for (char *name = strtok(ntp_servers, ", "); name && count < NTP_MAX_SERVERS; name = strtok(NULL, ", ")) names[count++] = name;
+    time_client.setPoolServers(names, count);
+}
+
+//update local time offset (only changes when crossing daylight saving transition)
+void updateTimeOffset() {
+    unsigned long utc = time_client.getEpochTime() - time_offset;
+    time_offset = time_zone.offset(utc);
+    time_client.setTimeOffset(time_offset);
+}
+
+//ms until timer with given period runs out
+unsigned long dueIn(unsigned long timer, unsigned long period) {
+    unsigned long elapsed = millis() - timer;
+    return (elapsed >= period) ? 0 : period - elapsed;
+}
+
+//scroll position of forecast screen (px), pauses after screen change and before the next one
+int forecastOffset() {
+    long range = max(forecast_days - 3, 0) * FORECAST_COLUMN;
+    long elapsed = (long)(millis() - screen_timer) - FORECAST_PAUSE;
+    long span = (long)config.screen_time - 2 * FORECAST_PAUSE;
+    if (elapsed <= 0 || span <= 0) return 0;
+    return min(range, range * elapsed / span);
+}
+
+//local "HH:MM" of utc time
+char *localClock(char *buf, uint32_t utc) {
+    uint32_t local = utc + time_offset;
+    formatTwoDigits(buf, local % 86400L / 3600);
+    buf[2] = ':';
+    formatTwoDigits(buf + 3, local % 3600 / 60);
+    return buf;
+}
+
+//sun and moon of local today (NULL when location is not configured)
+const AstroDay *astroToday() {
+    if (!config.latitude && !config.longitude) return NULL;
+    return &astroDay(time_client.getEpochTime() - time_offset, time_offset, config.latitude, config.longitude);
+}
+
+//switch night mode at sunset and sunrise
+void updateNight() {
+    const AstroDay *today = astroToday();
+    bool dark = today && !astroIsDay(*today, time_client.getEpochTime() - time_offset);
+    if (dark == night) return;
+    night = dark;
+    u8g2.setContrast(night ? NIGHT_CONTRAST : DAY_CONTRAST);
+    renderInvalidate(RENDER_WEATHER);   //day or night icon
+}
+
+//period of frames of the shown screen (0 = nothing moves)
+unsigned long framePeriod() {
+    if (screen == 1 && animationActive() && !night) return ANIMATION_PERIOD;
+    if (screen == 2 && forecast_offset < max(forecast_days - 3, 0) * FORECAST_COLUMN) return FORECAST_FRAME;
+    return 0;
+}
+
+//ms until next scheduled task of main loop (mqtt keepalive and OTA are covered by POWER_MAX_SLEEP)
+unsigned long nextDeadline() {
+    if (reconnect || !client.connected() || renderPending() || frame_pending || flushBusy()) return 0;
+    unsigned long next = dueIn(footer_timer, config.footer_time);
+    next = min(next, dueIn(screen_timer, config.screen_time));
+    if (framePeriod()) next = min(next, dueIn(frame_timer, framePeriod()));
+    next = min(next, dueIn(sync_timer, MINUTE));
+    next = min(next, dueIn(metrics_timer, METRICS_PERIOD));
+    next = min(next, dueIn(health_timer, HEALTH_PERIOD));
+    next = min(next, time_client.getUpdateDueIn());
+    for (int i = 0; i < config.city_count; i++) {
+        long wait = requests[i].due - millis();
+        if (requests[i].pending) next = min(next, (unsigned long)max(wait, 0L));
+    }
+    return next;
+}
+
+//first alert of city at or after given index that did not end yet (wrapping, -1 = none)
+int activeAlert(int index, int from) {
+    uint32_t now = time_client.getEpochTime() - time_offset;
+    for (int i = 0; i < ALERT_COUNT; i++) {
+        int alert = (from + i) % ALERT_COUNT;
+        if (weather[index].alerts[alert].end > now) return alert;
+    }
+    return -1;
+}
+
+//number of alerts of city that did not end yet
+int activeAlerts(int index) {
+    int count = 0;
+    for (int i = 0; i < ALERT_COUNT; i++) {
+        if (activeAlert(index, i) == i) count++;
+    }
+    return count;
+}
+
+//show alert right away (pre-empts the screen rotation)
+void showAlert(int index, int alert) {
+    city = index;
+    screen = ALERT_SCREEN;
+    alert_shown = alert;
+    screen_timer = millis();
+    alert_urgent = true;
+    trace(TRACE_DRAW, screen);
+    renderInvalidate(RENDER_SCREEN);
+}
+
+//copy text cut to buffer size without leaving incomplete utf-8 character at the end
+void copyText(char *buf, const char *text, size_t size) {
+    strlcpy(buf, text, size);
+    size_t len = strlen(buf);
+    size_t lead = len;
+    while (lead && (buf[lead - 1] & 0xC0) == 0x80) lead--;     //continuation bytes
+    if (!lead || !(buf[lead - 1] & 0x80)) return;               //ascii
+    uint8_t c = buf[lead - 1];
+    size_t need = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : 2;
+    if (len - (lead - 1) < need) buf[lead - 1] = '\0';
+}
+
+//bytes of text fitting one line of given number of characters (broken at space when possible)
+size_t wrapText(const char *text, uint8_t columns) {
+    size_t end = 0;
+    size_t space = 0;
+    uint8_t chars = 0;
+    while (text[end]) {
+        if (chars == columns) return (space && text[end] != ' ') ? space : end;
+        if (text[end] == ' ') space = end;
+        do end++; while ((text[end] & 0xC0) == 0x80);   //whole utf-8 character
+        chars++;
+    }
+    return end;
+}
+
+//build topic "<prefix><city name>" into buffer
+void cityTopic(char * buf, size_t len, const char * prefix, int index) {
+    snprintf(buf, len, "%s%s", prefix, config.cities[index]);
+}
+
+//get icon number from icon code ("10d" -> 10)
+int iconType(const char * icon) {
+    if (icon[0] == '\0' || icon[1] == '\0') return 0;
+    return (icon[0] - '0') * 10 + (icon[1] - '0');
+}
+
+//icon code is night variant ("01n")
+bool iconNight(const char * icon) {
+    return icon[0] != '\0' && icon[1] != '\0' && icon[2] == 'n';
+}
+
+//draw UTF-8 text of known width (locale texts or stringWidth() of monospace font) centered
+void drawCenteredString(const char * text, int y, int width) {
+    u8g2.drawUTF8(LCD_WIDTH/2 - width/2, y, text);
+}
+
+//format weather values of current city (only when city or data changed)
+const WeatherText &weatherText() {
+    const CityWeather &data = weather[city];
+    if (weather_text.city == city && weather_text.updated == data.updated) return weather_text;
+
+    weather_text.city = city;
+    weather_text.updated = data.updated;
+    formatTemperature(weather_text.temp, data.current.temp);
+    formatPercent(weather_text.humidity, data.current.humidity);
+    formatPressure(weather_text.pressure, data.current.pressure);
+    formatSpeed(weather_text.wind_speed, data.current.wind_speed);
+    return weather_text;
 }
 
 /*----(OTA)----*/
 void onStart() {
+    trace(TRACE_OTA_START);
     u8g2.clearBuffer();
     u8g2.setFont(u8g2_font_6x12_te);                //set update font
-    drawCenteredString("Update in progress", 16);   //print update message
+    char text[LOCALE_TEXT_LEN];
+    int width = localeLabel(text, LOCALE_UPDATING);
+    drawCenteredString(text, 16, width);            //print update message
     u8g2.setFontMode(1);                            //set font mode (transparency)
 }
 
@@ -91,7 +416,7 @@ void onProgress(size_t progress, size_t total) {
     int bar_width = 100;
     int bar_height = 9;
     int actual_progress = progress / (total / bar_width);
-    char buf[3];
+    char buf[4];
     itoa(actual_progress, buf, 10);
     int offset = (LCD_WIDTH - bar_width) / 2;
     
@@ -102,249 +427,847 @@ void onProgress(size_t progress, size_t total) {
     u8g2.setDrawColor(0);
     u8g2.drawBox(offset + actual_progress, 30, bar_width - actual_progress, bar_height);
     u8g2.setDrawColor(2);
-    drawCenteredString(buf, 38);
+    drawCenteredString(buf, 38, stringWidth(buf, FONT_6X12_ADVANCE));
     
     u8g2.sendBuffer();
 }
 
 void onEnd() {
-    drawCenteredString("Done", 56);   //print failed message
+    trace(TRACE_OTA_END);
+    char text[LOCALE_TEXT_LEN];
+    int width = localeLabel(text, LOCALE_DONE);
+    drawCenteredString(text, 56, width);    //print done message
     u8g2.sendBuffer();
 }
 
 void onError(ota_error_t error) {
-    drawCenteredString("Failed", 56);   //print failed message
+    trace(TRACE_OTA_ERROR, error);
+    char text[LOCALE_TEXT_LEN];
+    int width = localeLabel(text, LOCALE_FAILED);
+    drawCenteredString(text, 56, width);    //print failed message
     u8g2.sendBuffer();
+    renderInvalidate(RENDER_ALL);       //screens continue over the message
+    flushInvalidate();
 }
 
 
 /*----(UI ELEMENTS)----*/
-void bubbleAnimation(int current_bubble, int min, int max, int location, int spread, char *text){
-    LCD_CLEAR_AREA(LCD_WIDTH/2 - (spread+max+1), location - max, (spread+max+1)*2, (max+1)*2);  //clear area
+void bubbleAnimation(int current_bubble, int min, int max, int location, int spread, const char *text, int text_width, int count = 3){
+    int half = spread * (count - 1) / 2;    //distance of outer bubbles from the center
+    LCD_CLEAR_AREA(LCD_WIDTH/2 - (half+max+1), location - max, (half+max+1)*2, (max+1)*2);  //clear area
 
     //center text (if there is any)
-    if (text != NULL) drawCenteredString(text, 20);
-
-    //draw animation animation (center bubble centered)
-    switch ((current_bubble) % 3){
-        case 0:
-            u8g2.drawCircle(64 - spread, location, max);
-            u8g2.drawDisc  (64,          location, min);
-            u8g2.drawDisc  (64 + spread, location, min);
-            break;
-        case 1:
-            u8g2.drawDisc  (64 - spread, location, min);
-            u8g2.drawCircle(64,          location, max);
-            u8g2.drawDisc  (64 + spread, location, min);
-            break;
-        case 2:
-            u8g2.drawDisc  (64 - spread, location, min);
-            u8g2.drawDisc  (64,          location, min);
-            u8g2.drawCircle(64 + spread, location, max);
-            break;
-    }
-}
-
-void footer(){
+    if (text != NULL) drawCenteredString(text, 20, text_width);
+
+    //draw animation animation (bubbles centered)
+    for (int i = 0; i < count; i++) {
+        if (i == current_bubble % count) u8g2.drawCircle(64 - half + i*spread, location, max);
+        else                             u8g2.drawDisc  (64 - half + i*spread, location, min);
+    }
+}
+
+//position of current screen (extra bubble while the city has an active alert)
+void screenIndicator() {
+    LCD_CLEAR_AREA(31, 55, 60, 9);          //area of the widest indicator
+    bubbleAnimation(screen, 1, 2, 59, 12, NULL, 0, SCREEN_COUNT + (activeAlerts(city) ? 1 : 0));
+}
+
+//footer time (separator blinks every tick)
+void footerTime() {
     static bool separator = true;
-    
-    //clear footer area
-    LCD_CLEAR_AREA(0, 55, 30, 9);           //time
-    LCD_CLEAR_AREA(98, 55, 30, 9);           //temp
+    LCD_CLEAR_AREA(0, 55, 30, 9);           //clear time area
     
     u8g2.setFont(u8g2_font_profont11_tf);   //set font
     u8g2.drawHLine(0, 54, 128);             //draw horizontal line (start x, y, width)
     
-    //time
-    u8g2.setCursor(2, 64);                          //move cursor to time
-    u8g2.printf("%02d", time_client.getHours());    //print hours
-    u8g2.setCursor(19, 64);
-    u8g2.printf("%02d", time_client.getMinutes());  //print minutes
-    u8g2.setCursor(13, 63);
-    if (separator) u8g2.printf(":");                //print separator every other call
+    char tmp[4];
+    u8g2.drawStr(2, 64, formatTwoDigits(tmp, time_client.getHours()));     //print hours
+    u8g2.drawStr(19, 64, formatTwoDigits(tmp, time_client.getMinutes()));  //print minutes
+    if (separator) u8g2.drawStr(13, 63, ":");       //print separator every other call
     separator = !separator;                         //flip separator
-    
-    //temp
-    u8g2.setCursor(91, 64);                         //move cursor to temp
-    u8g2.printf("%02.1f\xb0%c", inside_temp, 'C');    //print temperature
 }
 
-void timeScreen() {
-    LCD_CLEAR_AREA(0, 0, 128, 54);  //clear screen part 
+//footer inside temperature
+void footerTemperature() {
+    LCD_CLEAR_AREA(91, 55, 37, 9);          //clear temperature area
+    u8g2.setFont(u8g2_font_profont11_tf);
+    u8g2.drawStr(91, 64, inside_text);      //print temperature (formatted on read)
+}
+
+//weekday and date of time screen
+void timeDate() {
+    LCD_CLEAR_AREA(0, 0, 128, 29);
     
     //variables
-    char tmp[10];
-    String day =   time_client.getFormattedDate().substring(8, 10);
-    String month = time_client.getFormattedDate().substring(5, 7);
-    String year =  time_client.getFormattedDate().substring(0, 4);
+    char tmp[12];
+    int year;
+    unsigned month, day;
+    civilFromDays(time_client.getEpochTime() / 86400L, year, month, day);
     
     //weekday
     u8g2.setFont(u8g2_font_6x12_te);                        //set font (for diacritics)
-    sprintf(tmp, "%s", days_of_week[time_client.getDay()]); //get weekday from array
-    int width = u8g2.getStrWidth(tmp);
-    width = LCD_WIDTH/2 - width/2;
-    u8g2.drawUTF8(width, 12, tmp);
+    char weekday[LOCALE_TEXT_LEN];
+    int width = localeWeekday(weekday, time_client.getDay());   //name and its width from locale pack
+    drawCenteredString(weekday, 12, width);
     
     //date
-    u8g2.setFont(u8g2_font_profont15_tr);
-    sprintf(tmp, "%s.%s.%s", day.c_str(), month.c_str(), year.c_str());
-    drawCenteredString(tmp, 26);
+    u8g2.setFont(u8g2_font_profont15_tn);
+    formatDate(tmp, day, month, year);
+    drawCenteredString(tmp, 26, stringWidth(tmp, FONT_PROFONT15_ADVANCE));
+}
 
-    //time
-    u8g2.setFont(u8g2_font_profont22_tr);
-    sprintf(tmp, "%s", time_client.getFormattedTime().c_str());
-    drawCenteredString(tmp, 46);
+//clock of time screen
+void timeClock() {
+    LCD_CLEAR_AREA(0, 29, 128, 16);
+    char tmp[12];
+    unsigned long now = time_client.getEpochTime();
+
+    //time (blitted from glyph cache, font is decoded only if the cache is not usable)
+    formatClock(tmp, (now % 86400L) / 3600, (now % 3600) / 60, now % 60);
+    if (!glyphCacheDraw(u8g2, LCD_WIDTH/2 - glyphCacheWidth(tmp)/2, 44, tmp)) {
+        u8g2.setFont(u8g2_font_profont22_tn);
+        drawCenteredString(tmp, 44, stringWidth(tmp, FONT_PROFONT22_ADVANCE));
+    }
+}
+
+//sunrise, sunset and moon of time screen (empty when location is not configured)
+void timeSun() {
+    LCD_CLEAR_AREA(0, 45, 128, 9);
+    const AstroDay *today = astroToday();
+    if (!today) return;
+
+    //sun icon and local sunrise-sunset (dashes when the sun does not rise or set)
+    char tmp[12];
+    u8g2.setFont(FONT_WEATHER_ICONS);   //glyphs drawn from icon fonts are listed in tools/font_subset.py
+    u8g2.drawStr(14, 53, "\x45");
+    u8g2.setFont(u8g2_font_profont10_tf);
+    if (today->polar) strcpy(tmp, "--:-- --:--");
+    else {
+        localClock(tmp, today->sunrise);
+        tmp[5] = '-';
+        localClock(tmp + 6, today->sunset);
+    }
+    u8g2.drawStr(24, 53, tmp);
+
+    //moon icon, illuminated part and ")" when waxing or "(" when waning
+    u8g2.setFont(FONT_WEATHER_ICONS);
+    u8g2.drawStr(86, 53, "\x42");
+    u8g2.setFont(u8g2_font_profont10_tf);
+    formatPercent(tmp, today->moon_light);
+    if (today->moon_phase % 4) strcat(tmp, (today->moon_phase < 4) ? ")" : "(");
+    u8g2.drawStr(96, 53, tmp);
 }
 
 void weatherScreen() {
     LCD_CLEAR_AREA(0, 0, 128, 54);
-    char tmp[16];   //variable to store strings
+    const DayData &curr_day = weather[city].current;
+    const WeatherText &text = weatherText();
 
     //get correct bitmap
-    bool day = (curr_day.icon[2] == 'd') ? true : false;    //get the icon letter (night or day)
-    int type = curr_day.icon.substring(0, 2).toInt();   //convert icon number from string to int
+    bool day = astroToday() ? !night : !iconNight(curr_day.icon);  //night mode or the icon letter (night or day)
+    int type = iconType(curr_day.icon);                     //convert icon number from string to int
 
     //draw the bitmap (64x42)
     switch (type){
-        case 1:  u8g2.drawXBM(0-12, 0, 64, 42, (day) ? clear_sky3_day_bits : clear_sky_night_bits);   break;    //12-12 0^ 2 | 17-18 1^ 1
-        case 2:  u8g2.drawXBM(0-8,  0, 64, 42, (day) ? few_clouds_day_bits : few_clouds1_night_bits); break;    //8-5   0^ 4 | 8-10  6^ 4
-        case 3:  u8g2.drawXBM(0-8,  0, 64, 42, scattered_clouds_bits);                                break;    //8-8   5^ 7
-        case 4:  u8g2.drawXBM(0-8,  0, 64, 42, broken_clouds_bits);                                   break;    //8-8   5^ 7
-        case 9:  u8g2.drawXBM(0-8,  0, 64, 42, shower_rain_bits);                                     break;    //8-8   0^ 1
-        case 10: u8g2.drawXBM(0-5,  0, 64, 42, (day) ? rain_day_bits : rain_night_bits);              break;    //10-10 0^ 0 | 10-8  0^0
-        case 11: u8g2.drawXBM(0-8,  0, 64, 42, thunderstorm_bits);                                    break;    //8-8   0^ 1
-        case 13: u8g2.drawXBM(0-8,  0, 64, 42, snow1_bits);                                           break;    //8-8   0^ 0
-        case 50: u8g2.drawXBM(0-8,  0, 64, 42, mist_bits);                                            break;    //8-8   5^ 5
+        case 1:  blitXBM<64, 42>(u8g2, 0-12, 0, (day) ? clear_sky3_day_bits : clear_sky_night_bits);   break;    //12-12 0^ 2 | 17-18 1^ 1
+        case 2:  blitXBM<64, 42>(u8g2, 0-8,  0, (day) ? few_clouds_day_bits : few_clouds1_night_bits); break;    //8-5   0^ 4 | 8-10  6^ 4
+        case 3:  blitXBM<64, 42>(u8g2, 0-8,  0, scattered_clouds_bits);                                break;    //8-8   5^ 7
+        case 4:  blitXBM<64, 42>(u8g2, 0-8,  0, broken_clouds_bits);                                   break;    //8-8   5^ 7
+        case 9:  blitXBM<64, 42>(u8g2, 0-8,  0, shower_rain_bits);                                     break;    //8-8   0^ 1
+        case 10: blitXBM<64, 42>(u8g2, 0-5,  0, (day) ? rain_day_bits : rain_night_bits);              break;    //10-10 0^ 0 | 10-8  0^0
+        case 11: blitXBM<64, 42>(u8g2, 0-8,  0, thunderstorm_bits);                                    break;    //8-8   0^ 1
+        case 13: blitXBM<64, 42>(u8g2, 0-8,  0, snow1_bits);                                           break;    //8-8   0^ 0
+        case 50: blitXBM<64, 42>(u8g2, 0-8,  0, mist_bits);                                            break;    //8-8   5^ 5
         default: break;
     }
 
+    //animate the bitmap (same position, left of the separator line)
+    switch (type){
+        case 2:  animationStart((day) ? &few_clouds_day_animation : &few_clouds1_night_animation, 0-8, 0, 54); break;
+        case 3:  animationStart(&scattered_clouds_animation, 0-8, 0, 54);                                   break;
+        case 4:  animationStart(&broken_clouds_animation, 0-8, 0, 54);                                      break;
+        case 9:  animationStart(&shower_rain_animation, 0-8, 0, 54);                                        break;
+        case 10: animationStart((day) ? &rain_day_animation : &rain_night_animation, 0-5, 0, 54);           break;
+        case 11: animationStart(&thunderstorm_animation, 0-8, 0, 54);                                       break;
+        case 13: animationStart(&snow1_animation, 0-8, 0, 54);                                              break;
+        case 50: animationStart(&mist_animation, 0-8, 0, 54);                                               break;
+        default: animationStart(NULL, 0, 0, 0);                                                             break;
+    }
+
     //print temperature
     u8g2.setFont(u8g2_font_profont15_tf);
-    sprintf(tmp, "%.1f\xb0", curr_day.temp);
-    int txt_start = 54/2 - u8g2.getStrWidth(tmp)/2;
-    u8g2.drawStr(txt_start, 53, tmp);
+    int txt_start = 54/2 - u8g2.getStrWidth(text.temp)/2;
+    u8g2.drawStr(txt_start, 53, text.temp);
 
     //humidity
     u8g2.setFont(u8g2_font_profont11_tf);
-    sprintf(tmp, "%d%%", curr_day.humidity);
-    u8g2.drawXBM(58, 12, 11, 12, humidity2_bits);
-    u8g2.drawStr(75, 22, tmp);
+    blitXBM<11, 12>(u8g2, 58, 12, humidity2_bits);
+    u8g2.drawStr(75, 22, text.humidity);
 
     //pressure
-    sprintf(tmp, "%.3fbar", curr_day.pressure);
-    u8g2.drawXBM(56, 28, 15, 7, pressure2_bits);
-    u8g2.drawStr(75, 36, tmp);
+    blitXBM<15, 7>(u8g2, 56, 28, pressure2_bits);
+    u8g2.drawStr(75, 36, text.pressure);
 
     //wind speed
-    sprintf(tmp, "%.1fm/s", curr_day.wind_speed);
-    u8g2.drawXBM(58, 40, 11, 11, speed_bits);
-    u8g2.drawStr(75, 50, tmp);
+    blitXBM<11, 11>(u8g2, 58, 40, speed_bits);
+    u8g2.drawStr(75, 50, text.wind_speed);
 
     //city name and gps icon
-    u8g2.setFont(u8g2_font_open_iconic_www_1x_t);
+    u8g2.setFont(FONT_WWW_ICONS);
     u8g2.drawStr(56, 9, "\x47");
     u8g2.setFont(u8g2_font_6x12_te);
-    u8g2.drawUTF8(65, 8, city.c_str());
+    u8g2.drawUTF8(65, 8, config.cities[city]);
+    if (!weather[city].updated || millis() - weather[city].updated > WEATHER_STALE) u8g2.drawStr(122, 8, "?"); //mark old data
 
     //draw lines
     u8g2.drawVLine(54, 0, 54);
     u8g2.drawHLine(54, 10, 74);
 }
 
-void forecastScreen() {
-    LCD_CLEAR_AREA(0, 0, 128, 54);
-    char tmp[10];
+void weatherAnimation() {
+    uint32_t start = profileStart();
+    animationStep(u8g2);
+    profileEnd(PROFILE_ANIM, start);
+}
+
+//forecast of one day at x (separator line on the right side)
+void forecastColumn(int x, const DailyData &data) {
+    char tmp[LOCALE_TEXT_LEN];
+    bool day = !(data.icon & DAILY_NIGHT);                  //night or day icon
+    int type = data.icon & ~DAILY_NIGHT;
 
     u8g2.setFont(u8g2_font_profont10_tf);
+    localeWeekdayShort(tmp, ((data.dt + time_offset) / 86400L + 4) % 7);   //local weekday of the entry (1.1.1970 was Thursday)
+    u8g2.drawUTF8(x + 16, 6, tmp);
+    blitXBM<6, 6>(u8g2, x + 3, 39, sun_tiny_bits);
+    blitXBM<6, 6>(u8g2, x + 3, 47, moon_tiny_bits);
+    u8g2.drawStr(x + 12, 45, formatTemperature(tmp, data.day_temp));
+    u8g2.drawStr(x + 12, 53, formatTemperature(tmp, data.night_temp));
+
+    //draw the bitmap (40x30)
+    switch (type){
+        case 1:  blitXBM<40, 30>(u8g2, x + 1, 7, (day) ? clear_sky3_day_small_bits : clear_sky_night_small_bits);  break;    //12-12 0^ 2 | 17-18 1^ 1
+        case 2:  blitXBM<40, 30>(u8g2, x + 1, 7, (day) ? few_clouds_day_small_bits : few_clouds_night_small_bits); break;    //8-5   0^ 4 | 8-10  6^ 4
+        case 3:  blitXBM<40, 30>(u8g2, x + 1, 7, scattered_clouds_small_bits);                                     break;    //8-8   5^ 7
+        case 4:  blitXBM<40, 30>(u8g2, x + 1, 7, broken_clouds_small_bits);                                        break;    //8-8   5^ 7
+        case 9:  blitXBM<40, 30>(u8g2, x + 1, 7, shower_rain_small_bits);                                          break;    //8-8   0^ 1
+        case 10: blitXBM<40, 30>(u8g2, x + 1, 7, (day) ? rain_day_small_bits : rain_night_small_bits);             break;    //10-10 0^ 0 | 10-8  0^0
+        case 11: blitXBM<40, 30>(u8g2, x + 1, 7, thunderstorm_small_bits);                                         break;    //8-8   0^ 1
+        case 13: blitXBM<40, 30>(u8g2, x + 1, 7, snow_small_bits);                                                 break;    //8-8   0^ 0
+        case 50: blitXBM<40, 30>(u8g2, x + 1, 7, mist_small_bits);                                                 break;    //8-8   5^ 5
+        default: break;
+    }
 
-    for (int i = 0; i < LEN(forecast); i++){
-        bool day = forecast[i].icon[2];                         //get the icon letter (night or day)
-        int type = forecast[i].icon.substring(0, 2).toInt();    //convert icon number from string to int
-
-        int column_offset = (i % 3) * (43);
-        u8g2.drawStr(column_offset + 16, 6, days_of_week_short[(time_client.getDay() + i + 1) % 7]);
-        u8g2.drawXBM(column_offset + 3, 39, 6, 6, sun_tiny_bits);
-        u8g2.drawXBM(column_offset + 3, 47, 6, 6, moon_tiny_bits);
-        sprintf(tmp, "%.1f\xb0", forecast[i].day_temp);
-        u8g2.drawStr(column_offset + 12, 45, tmp);
-        sprintf(tmp, "%.1f\xb0", forecast[i].night_temp);
-        u8g2.drawStr(column_offset + 12, 53, tmp);
-
-        //draw the bitmap (40x30)
-        switch (type){
-            case 1:  u8g2.drawXBM(column_offset + 1, 7, 40, 30, (day) ? clear_sky3_day_small_bits : clear_sky_night_small_bits);  break;    //12-12 0^ 2 | 17-18 1^ 1
-            case 2:  u8g2.drawXBM(column_offset + 1, 7, 40, 30, (day) ? few_clouds_day_small_bits : few_clouds_night_small_bits); break;    //8-5   0^ 4 | 8-10  6^ 4
-            case 3:  u8g2.drawXBM(column_offset + 1, 7, 40, 30, scattered_clouds_small_bits);                                     break;    //8-8   5^ 7
-            case 4:  u8g2.drawXBM(column_offset + 1, 7, 40, 30, broken_clouds_small_bits);                                        break;    //8-8   5^ 7
-            case 9:  u8g2.drawXBM(column_offset + 1, 7, 40, 30, shower_rain_small_bits);                                          break;    //8-8   0^ 1
-            case 10: u8g2.drawXBM(column_offset + 1, 7, 40, 30, (day) ? rain_day_small_bits : rain_night_small_bits);             break;    //10-10 0^ 0 | 10-8  0^0
-            case 11: u8g2.drawXBM(column_offset + 1, 7, 40, 30, thunderstorm_small_bits);                                         break;    //8-8   0^ 1
-            case 13: u8g2.drawXBM(column_offset + 1, 7, 40, 30, snow_small_bits);                                                 break;    //8-8   0^ 0
-            case 50: u8g2.drawXBM(column_offset + 1, 7, 40, 30, mist_small_bits);                                                 break;    //8-8   5^ 5
-            default: break;
+    u8g2.drawVLine(x + 42, 0, 54);
+}
+
+//forecast columns at current scroll position (pre-rendered columns are only copied)
+void forecastScroll() {
+    int offset = forecastOffset();
+    if (offset == forecast_offset) return;
+    forecast_offset = offset;
+
+    uint32_t start = profileStart();
+    LCD_CLEAR_AREA(0, 0, LCD_WIDTH, FORECAST_HEIGHT);
+    for (int i = 0; i < forecast_days; i++) {
+        int x = i * FORECAST_COLUMN - offset;
+        if (x <= -FORECAST_COLUMN || x >= LCD_WIDTH) continue;
+        if (Display::layout == DISPLAY_HORIZONTAL) blitXBM<FORECAST_COLUMN, FORECAST_HEIGHT>(u8g2, x, 0, forecast_tiles[i]);
+        else forecastColumn(x, weather[city].daily[forecast_index[i]]);
+    }
+    profileEnd(PROFILE_ANIM, start);
+}
+
+void forecastScreen() {
+    const CityWeather &data = weather[city];
+    long today = time_client.getEpochTime() / 86400L;      //local day
+
+    //days after today (labels and order come from dt of each entry, not from today's weekday)
+    forecast_days = 0;
+    for (int i = 0; i < DAILY_COUNT && forecast_days < (int)LEN(forecast_index); i++) {
+        if (data.daily[i].dt && (long)((data.daily[i].dt + time_offset) / 86400L) > today) forecast_index[forecast_days++] = i;
+    }
+
+    //pre-render the columns (horizontal buffer only)
+    if (Display::layout == DISPLAY_HORIZONTAL) {
+        for (int i = 0; i < forecast_days; i++) {
+            LCD_CLEAR_AREA(0, 0, FORECAST_COLUMN, FORECAST_HEIGHT);
+            forecastColumn(0, data.daily[forecast_index[i]]);
+            blitCapture<FORECAST_COLUMN, FORECAST_HEIGHT>(u8g2, 0, forecast_tiles[i]);
         }
+    }
+    forecast_offset = -1;
+    forecastScroll();
+}
+
+void precipitationScreen() {
+    LCD_CLEAR_AREA(0, 0, 128, 54);
+    char tmp[16];
+    const CityWeather &data = weather[city];
+
+    //temperature range for the chart
+    int t_min = data.hourly_temp[0];
+    int t_max = data.hourly_temp[0];
+    for (int i = 1; i < HOURLY_COUNT; i++) {
+        if (data.hourly_temp[i] < t_min) t_min = data.hourly_temp[i];
+        if (data.hourly_temp[i] > t_max) t_max = data.hourly_temp[i];
+    }
 
+    //header
+    u8g2.setFont(u8g2_font_profont10_tf);
+    strcat(formatInt(tmp, HOURLY_COUNT), "h");
+    u8g2.drawStr(0, 6, tmp);
+    formatInt(tmp, roundFixed(t_min, 1));
+    strcat(tmp, "..");
+    strcat(formatInt(tmp + strlen(tmp), roundFixed(t_max, 1)), "\xb0");
+    u8g2.drawStr(LCD_WIDTH - u8g2.getStrWidth(tmp), 6, tmp);
+    if (t_max == t_min) t_max++;
+
+    //hourly chart (bars - precipitation probability, filled when it rains, line - temperature)
+    int prev_y = 0;
+    for (int i = 0; i < HOURLY_COUNT; i++) {
+        int x = 4 + i*5;
+        int h = data.hourly_pop[i] * 30 / 100;
+        if (data.hourly_rain[i]) u8g2.drawBox  (x, 39 - h, 4, h + 1);
+        else if (h)              u8g2.drawFrame(x, 39 - h, 4, h + 1);
+
+        int y = 38 - (data.hourly_temp[i] - t_min) * 28 / (t_max - t_min);
+        if (i) u8g2.drawLine(x - 3, prev_y, x + 2, y);
+        prev_y = y;
     }
+    u8g2.drawHLine(0, 40, 128);
 
-    u8g2.drawVLine(42, 0, 54);
-    u8g2.drawVLine(85, 0, 54);
+    //minutely chart (precipitation for next hour, pairs of minutes)
+    for (int i = 0; i < MINUTELY_COUNT / 2; i++) {
+        int rain = max(data.minutely[i*2], data.minutely[i*2 + 1]);
+        int h = (rain > 0) ? min(11, 1 + rain / 5) : 0; //full height at 5mm/h
+        if (h) u8g2.drawBox(4 + i*4, 53 - h, 3, h);
+    }
 }
 
+//alert of shown city (name, local time range and start of description)
+void alertScreen() {
+    LCD_CLEAR_AREA(0, 0, 128, 54);
+    const WeatherAlert &alert = weather[city].alerts[alert_shown];
+    char tmp[24];
 
-void startWifi() {
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid.c_str(), passw.c_str());
+    //name in inverted header, number of alerts when there are more
+    u8g2.setFont(u8g2_font_6x12_te);
+    u8g2.drawBox(0, 0, LCD_WIDTH, 11);
+    u8g2.setDrawColor(0);
+    u8g2.drawUTF8(2, 9, alert.event);
+    int count = activeAlerts(city);
+    if (count > 1) {
+        formatInt(tmp, count);
+        u8g2.setDrawColor(1);
+        u8g2.drawBox(LCD_WIDTH - 8, 0, 8, 11);
+        u8g2.setDrawColor(0);
+        u8g2.drawStr(LCD_WIDTH - 7, 9, tmp);
+    }
+    u8g2.setDrawColor(1);
+
+    //"DD.MM HH:MM-DD.MM HH:MM" in local time
+    u8g2.setFont(u8g2_font_profont10_tf);
+    uint32_t times[2] = {alert.start, alert.end};
+    char *end = tmp;
+    for (uint8_t i = 0; i < 2; i++) {
+        uint32_t local = times[i] + time_offset;
+        int year;
+        unsigned month, day;
+        civilFromDays(local / 86400L, year, month, day);
+        formatTwoDigits(end, day);
+        end[2] = '.';
+        formatTwoDigits(end + 3, month);
+        end[5] = ' ';
+        localClock(end + 6, times[i]);
+        end[11] = '-';
+        end += 12;
+    }
+    end[-1] = '\0';
+    u8g2.drawStr(LCD_WIDTH/2 - stringWidth(tmp, FONT_PROFONT10_ADVANCE)/2, 20, tmp);
+
+    //description wrapped to lines of 21 characters
+    u8g2.setFont(u8g2_font_6x12_te);
+    const char *text = alert.description;
+    for (int y = 31; y <= 53 && *text; y += 11) {
+        while (*text == ' ') text++;
+        size_t len = wrapText(text, LCD_WIDTH / 6);
+        char line[sizeof(alert.description)];
+        strlcpy(line, text, len + 1);
+        u8g2.drawUTF8(0, y, line);
+        text += len;
+    }
+}
+
+//widgets of the screens and data they show (redrawn only when it changes)
+const Widget widgets[] = {
+    {RENDER_SCREEN | RENDER_MINUTE,                  0, timeDate},
+    {RENDER_SCREEN | RENDER_SECOND,                  0, timeClock},
+    {RENDER_SCREEN | RENDER_MINUTE,                  0, timeSun},
+    {RENDER_SCREEN | RENDER_WEATHER | RENDER_MINUTE, 1, weatherScreen},  //minute for old data mark
+    {RENDER_FRAME,                                   1, weatherAnimation},
+    {RENDER_SCREEN | RENDER_WEATHER,                 2, forecastScreen},
+    {RENDER_FRAME,                                   2, forecastScroll},
+    {RENDER_SCREEN | RENDER_WEATHER,                 3, precipitationScreen},
+    {RENDER_SCREEN | RENDER_WEATHER,      ALERT_SCREEN, alertScreen},
+    {RENDER_SCREEN,                                 -1, screenIndicator},
+    {RENDER_SECOND,                                 -1, footerTime},
+    {RENDER_INSIDE,                                 -1, footerTemperature},
+};
+
+
+//connect with given credentials, show animation meanwhile
+//@return false after 10 seconds without connection
+bool connectWifi(const char *ssid, const char *passw) {
+    WiFi.begin(ssid, passw);
     int timer = 0;
+    char text[LOCALE_TEXT_LEN];
+    int width = localeLabel(text, LOCALE_CONNECTING);
+    u8g2.setFont(u8g2_font_6x12_te);                                //font of locale texts
     while(WiFi.status() != WL_CONNECTED) {
-        bubbleAnimation(timer, 2, 5, 40, 18, "Connecting to WiFi"); //run animation
+        bubbleAnimation(timer, 2, 5, 40, 18, text, width);          //run animation
         u8g2.sendBuffer();                                          //write it to screen
         timer++;                                                    //increase timeout
         delay(500);                                                 //delay
-        if (timer >= 20) ESP.restart();                             //reset after 10 seconds
+        traceTick();
+        if (timer >= 20) return false;                              //give up after 10 seconds
     }
+    return true;
+}
+
+void startWifi() {
+    trace(TRACE_WIFI_CONNECTING);
+    WiFi.mode(WIFI_STA);
+
+    //new credentials from configuration, keep them only if they work
+    bool connected = false;
+    if (wifi_trial) {
+        wifi_trial = false;
+        connected = connectWifi(trial_ssid, trial_passw);
+        if (connected) {
+            strlcpy(config.ssid, trial_ssid, sizeof(config.ssid));
+            strlcpy(config.passw, trial_passw, sizeof(config.passw));
+            configWrite(config);
+        }
+        else {
+            trace(TRACE_WIFI_FALLBACK);
+            WiFi.disconnect();
+        }
+    }
+
+    if (!connected && !connectWifi(config.ssid, config.passw)) {
+        trace(TRACE_WIFI_RESTART);
+        ESP.restart();                                              //reset if even stored credentials fail
+    }
+    renderInvalidate(RENDER_ALL);   //animation drew over the screen
+    flushInvalidate();
+    trace(TRACE_WIFI_CONNECTED);
 }
 
 //Send status update
 void updateStatus(String status) {
-    client.publish(("devices/" + device_name).c_str(), (time_client.getFormattedTime() + " " + status).c_str(), true);
+    client.publish(("devices/" + String(config.device_name)).c_str(), (time_client.getFormattedTime() + " " + status).c_str(), true);
+}
+
+//Send loop timing metrics and heap/stack health
+//publish payload of any size (written directly to the connection, not through mqtt buffer)
+bool publishLarge(const char *topic, const uint8_t *payload, unsigned int length, bool retained) {
+    return client.beginPublish(topic, length, retained) && client.write(payload, length) == length && client.endPublish();
+}
+
+void publishMetrics() {
+    char topic[64];
+    static char report[512];
+    snprintf(topic, sizeof(topic), "devices/%s/metrics", config.device_name);
+    size_t len = profileReport(report, sizeof(report));
+    len = appendText(report, sizeof(report), len, "\n");
+    len += renderReport(report + len, sizeof(report) - len);
+    len = appendText(report, sizeof(report), len, "\n");
+    len += powerReport(report + len, sizeof(report) - len);
+    publishLarge(topic, (const uint8_t *)report, len, false);
+
+    snprintf(topic, sizeof(topic), "devices/%s/health", config.device_name);
+    len = healthReport(report, sizeof(report));
+    publishLarge(topic, (const uint8_t *)report, len, false);
 }
 
 /*----(MQTT)----*/
-//update weather data on new message (as we are listening on single topic)
-void onMessage(char* topic, byte* payload, unsigned int length) {
-    if (String(topic) != String("weather/" + city)) return;  //skip if not our city
+//request weather data for city (not retained, answer comes to weather/<city>)
+void requestWeather(int index) {
+    static uint16_t request_id = random(0x10000);
+    char topic[64];
+    char payload[96];
+    cityTopic(topic, sizeof(topic), "weather/requests/", index);
+    snprintf(payload, sizeof(payload), "{\"id\":%u,\"ts\":%lu,\"device\":\"%s\"}",
+             request_id++, time_client.getEpochTime() - time_offset, config.device_name);
+    client.publish(topic, payload, false);
+    requests[index].requested = millis();
+    requests[index].pending = false;
+}
+
+//city has no data or too old data
+bool weatherStale(int index) {
+    return !weather[index].updated || millis() - weather[index].updated > WEATHER_STALE;
+}
+
+//request weather after random delay, dropped when fresh data arrives meanwhile
+//(retained message or answer to request of another station)
+void scheduleRequest(int index, unsigned long wait) {
+    requests[index].due = millis() + wait + random(WEATHER_JITTER);
+    requests[index].pending = true;
+}
+
+//send scheduled weather requests still needed
+void sendRequests() {
+    for (int i = 0; i < config.city_count; i++) {
+        if (!requests[i].pending || (long)(millis() - requests[i].due) < 0) continue;
+        if (!weatherStale(i) && !requests[i].full) requests[i].pending = false;  //someone else's request was answered
+        else if (client.connected()) requestWeather(i);
+    }
+}
+
+//set single field of weather record from value in One Call units (index of day, hour or minute)
+void setWeatherField(CityWeather &data, uint8_t field, int index, const char *value) {
+    DailyData *day = (index >= 0 && index < DAILY_COUNT) ? &data.daily[index] : NULL;
+    bool hour = index >= 0 && index < HOURLY_COUNT;
+    bool minute = index >= 0 && index < MINUTELY_COUNT;
+
+    switch (field) {
+        case FIELD_DT:          data.dt                 = strtoul(value, NULL, 10);                          break;
+        case FIELD_TEMP:        data.current.temp       = kelvinToDeci(parseFixed(value, 2));                break;
+        case FIELD_HUMIDITY:    data.current.humidity   = constrain(parseFixed(value, 0), 0, 100);           break;
+        case FIELD_PRESSURE:    data.current.pressure   = constrain(parseFixed(value, 0), 0, 65535);         break;
+        case FIELD_WIND_SPEED:  data.current.wind_speed = constrain(parseFixed(value, 1), 0, 65535);         break;
+        case FIELD_UVI:         data.current.uvi        = constrain(parseFixed(value, 2), 0, 65535);         break;
+        case FIELD_ICON:        strlcpy(data.current.icon, value, sizeof(data.current.icon));                break;
+        case FIELD_DAY_TEMP:    if (day) day->day_temp   = kelvinToDeci(parseFixed(value, 2));               break;
+        case FIELD_NIGHT_TEMP:  if (day) day->night_temp = kelvinToDeci(parseFixed(value, 2));               break;
+        case FIELD_DAY_UVI:     if (day) day->uvi        = constrain(parseFixed(value, 2), 0, 65535);        break;
+        case FIELD_DAY_ICON:    if (day) day->icon = iconType(value) | (iconNight(value) ? DAILY_NIGHT : 0); break;
+        case FIELD_DAY_DT:      if (day) day->dt         = strtoul(value, NULL, 10);                         break;
+        case FIELD_HOUR_TEMP:   if (hour) data.hourly_temp[index] = kelvinToDeci(parseFixed(value, 2));      break;
+        case FIELD_HOUR_POP:    if (hour) data.hourly_pop[index]  = constrain(parseFixed(value, 2), 0, 100); break;
+        case FIELD_HOUR_RAIN:   if (hour) data.hourly_rain[index] = min(255L, parseFixed(value, 1));         break;
+        case FIELD_MINUTE_RAIN: if (minute) data.minutely[index]  = min(255L, parseFixed(value, 1));         break;
+    }
+}
+
+//save single weather value while parsing full message
+void onWeatherValue(JsonStream &json, const char *value, void *ctx) {
+    CityWeather &data = *(CityWeather *)ctx;
+    uint8_t field = 0;
+
+    //current day
+    if (json.depth() == 1 && json.match("version")) data.version = strtoul(value, NULL, 10);
+    else if (json.depth() == 2 || json.depth() == 4) {
+        if      (json.match("current.dt"))                field = FIELD_DT;
+        else if (json.match("current.temp"))              field = FIELD_TEMP;
+        else if (json.match("current.humidity"))          field = FIELD_HUMIDITY;
+        else if (json.match("current.pressure"))          field = FIELD_PRESSURE;
+        else if (json.match("current.wind_speed"))        field = FIELD_WIND_SPEED;
+        else if (json.match("current.uvi"))               field = FIELD_UVI;
+        else if (json.match("current.weather.0.icon"))    field = FIELD_ICON;
+    }
+
+    //forecast, hourly and minutely charts
+    int index = json.index(1);
+    if (!field && index >= 0) {
+        if      (json.match("daily.#.dt"))                field = FIELD_DAY_DT;
+        else if (json.match("daily.#.temp.day"))          field = FIELD_DAY_TEMP;
+        else if (json.match("daily.#.temp.night"))        field = FIELD_NIGHT_TEMP;
+        else if (json.match("daily.#.uvi"))               field = FIELD_DAY_UVI;
+        else if (json.match("daily.#.weather.0.icon"))    field = FIELD_DAY_ICON;
+        else if (json.match("hourly.#.temp"))             field = FIELD_HOUR_TEMP;
+        else if (json.match("hourly.#.pop"))              field = FIELD_HOUR_POP;
+        else if (json.match("hourly.#.rain.1h") || json.match("hourly.#.snow.1h")) field = FIELD_HOUR_RAIN;
+        else if (json.match("minutely.#.precipitation"))  field = FIELD_MINUTE_RAIN;
+    }
+
+    if (field) setWeatherField(data, field, index, value);
+
+    //alerts (fixed capacity, later ones are dropped)
+    else if (index >= 0 && index < ALERT_COUNT) {
+        WeatherAlert &alert = data.alerts[index];
+        if      (json.match("alerts.#.event"))        copyText(alert.event, value, sizeof(alert.event));
+        else if (json.match("alerts.#.start"))        alert.start = strtoul(value, NULL, 10);
+        else if (json.match("alerts.#.end"))          alert.end   = strtoul(value, NULL, 10);
+        else if (json.match("alerts.#.description"))  copyText(alert.description, value, sizeof(alert.description));
+    }
+}
+
+//delta message being parsed (city is known only when the whole message was received)
+typedef struct {
+    uint32_t base;      //version the delta applies to
+    uint32_t version;   //version after the delta
+    uint8_t field;      //field of current patch
+    int index;          //index of current patch
+    char patches[DELTA_BUFFER]; //field, index and value (null terminated) of each patch
+    unsigned int used;  //bytes of patches
+    bool overflow;      //patches did not fit (delta is not applied)
+    bool foreign;       //message is not a delta (parsing stopped)
+} WeatherDelta;
+
+//save single value of delta message {"base":1,"version":2,"d":[field,index,value, ...]}
+void onDeltaValue(JsonStream &json, const char *value, void *ctx) {
+    WeatherDelta &delta = *(WeatherDelta *)ctx;
+    if      (json.match("base"))    delta.base    = strtoul(value, NULL, 10);
+    else if (json.match("version")) delta.version = strtoul(value, NULL, 10);
+    else if (json.match("d.#")) {
+        switch (json.index(1) % 3) {
+            case 0: delta.field = atoi(value); break;
+            case 1: delta.index = atoi(value); break;
+            case 2: {
+                size_t length = strlen(value) + 1;
+                if (delta.used + 2 + length > sizeof(delta.patches)) {
+                    delta.overflow = true;
+                    break;
+                }
+                delta.patches[delta.used++] = delta.field;
+                delta.patches[delta.used++] = (delta.index >= 0 && delta.index < 255) ? delta.index : 255;  //255 = out of every range
+                memcpy(delta.patches + delta.used, value, length);
+                delta.used += length;
+                break;
+            }
+        }
+    }
+    else delta.foreign = true;      //full weather data
+}
+
+//apply patches of parsed delta to weather record
+void applyDelta(const WeatherDelta &delta, CityWeather &data) {
+    for (unsigned int i = 0; i < delta.used; i += 3 + strlen(delta.patches + i + 2)) {
+        uint8_t index = delta.patches[i + 1];
+        setWeatherField(data, delta.patches[i], index == 255 ? -1 : index, delta.patches + i + 2);
+    }
+}
+
+CityWeather parsed_weather;                             //weather being parsed
+JsonStream weather_json(onWeatherValue, &parsed_weather);  //weather parser
+WeatherDelta weather_delta;                             //delta being parsed
+JsonStream delta_json(onDeltaValue, &weather_delta);    //delta parser
+
+//feeds payload to the weather and delta parsers while PubSubClient receives it (whole message is never buffered,
+//topic is not known yet), delta parser stops at the first value of full weather data
+class WeatherWriter : public Stream {
+  public:
+    uint32_t cycles = 0;    //parsing time of current message
+
+    size_t write(uint8_t c) override {
+        uint32_t start = profileStart();
+        weather_json.feed((char)c);
+        if (!weather_delta.foreign) delta_json.feed((char)c);
+        cycles += profileStart() - start;
+        return 1;
+    }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    void flush() override {}
+};
+WeatherWriter weather_writer;
+
+//start parsing next streamed message
+void resetWeatherStream() {
+    parsed_weather = CityWeather();
+    weather_json.reset();
+    weather_delta = WeatherDelta();
+    delta_json.reset();
+    weather_writer.cycles = 0;
+}
+
+//apply changed configuration without reboot
+void onConfig(byte* payload, unsigned int length) {
+    Config old = config;
+    if (!configParse(config, payload, length)) return;  //skip invalid configuration
+    trace(TRACE_CONFIG);
+
+    //wifi credentials - reconnect in loop, they replace the current ones only after successful connection
+    if (strcmp(old.ssid, config.ssid) || strcmp(old.passw, config.passw)) {
+        strlcpy(trial_ssid, config.ssid, sizeof(trial_ssid));
+        strlcpy(trial_passw, config.passw, sizeof(trial_passw));
+        strlcpy(config.ssid, old.ssid, sizeof(config.ssid));
+        strlcpy(config.passw, old.passw, sizeof(config.passw));
+        wifi_trial = true;
+        WiFi.disconnect();
+    }
+
+    //more cities than allocated at boot - restart with the new configuration
+    if (config.city_count > weather_slots) {
+        configWrite(config);
+        ESP.restart();
+    }
+
+    //cities - drop data of changed cities
+    bool cities = old.city_count != config.city_count;
+    for (int i = 0; i < config.city_count; i++) {
+        if (strcmp(old.cities[i], config.cities[i])) {
+            weather[i] = CityWeather();
+            requests[i] = WeatherRequest();
+            cities = true;
+        }
+    }
+    if (city >= config.city_count) city = 0;
+    if (cities) renderInvalidate(RENDER_ALL);
+
+    //mqtt server, device name or topics - reconnect in loop
+    if (cities || strcmp(old.mqtt_addr, config.mqtt_addr) || strcmp(old.device_name, config.device_name)) reconnect = true;
+
+    //ntp servers and time zone
+    if (strcmp(old.ntp_addr, config.ntp_addr)) setNtpServers();
+    if (old.power_save != config.power_save) powerMode(config.power_save);
+    if (old.latitude != config.latitude || old.longitude != config.longitude) renderInvalidate(RENDER_MINUTE | RENDER_WEATHER);
+    setTimezone();
+    updateTimeOffset();
 
-    //get data as json
-    DynamicJsonDocument doc(6144);
-    deserializeJson(doc, payload);
-    JsonObject root = doc.as<JsonObject>();
+    configSave();               //write it to flash
+    updateStatus("config update");
+}
 
-    //save current day
-    curr_day.temp       = (float)(root["current"]["temp"]) - 273.15;
-    curr_day.humidity   =   (int)(root["current"]["humidity"]);
-    curr_day.pressure   = (float)(root["current"]["pressure"] )/ 1000.0;
-    curr_day.wind_speed = (float)(root["current"]["wind_speed"]);
-    curr_day.uvi        = (float)(root["current"]["uvi"]);
-    curr_day.icon       =        (root["current"]["weather"][0]["icon"].as<String>());
+//find city by name
+int cityIndex(const char *name) {
+    for (int i = 0; i < config.city_count; i++) {
+        if (!strcmp(name, config.cities[i])) return i;
+    }
+    return -1;
+}
 
-    //save forecast
-    for (unsigned int i = 0; i < LEN(forecast); i++) {
-        forecast[i].day_temp   = (float)(root["daily"][i+1]["temp"]["day"]) - 273.15;
-        forecast[i].night_temp = (float)(root["daily"][i+1]["temp"]["night"]) - 273.15;
-        forecast[i].uvi        = (float)(root["daily"][i+1]["uvi"]);
-        forecast[i].icon       =         root["daily"][i+1]["weather"][0]["icon"].as<String>();
+//use parsed weather as new data of city
+void commitWeather(int index) {
+    //age data by their time (retained message may be old)
+    parsed_weather.updated = millis();
+    unsigned long now = time_client.getEpochTime() - time_offset;
+    if (time_client.isTimeSet() && parsed_weather.dt && parsed_weather.dt < now) {
+        parsed_weather.updated -= min(now - parsed_weather.dt, (unsigned long)(WEATHER_STALE / SECOND + 1)) * SECOND;
+    }
+    //alert not known before (same name and start) pre-empts the screen rotation
+    int fresh = -1;
+    for (int i = 0; i < ALERT_COUNT && fresh < 0; i++) {
+        const WeatherAlert &alert = parsed_weather.alerts[i];
+        if (!alert.end) continue;
+        fresh = i;
+        for (int k = 0; k < ALERT_COUNT; k++) {
+            const WeatherAlert &known = weather[index].alerts[k];
+            if (known.start == alert.start && !strcmp(known.event, alert.event)) fresh = -1;
+        }
     }
 
+    weather[index] = parsed_weather;
+    if (index == city) renderInvalidate(RENDER_WEATHER);
+    if (fresh >= 0 && activeAlert(index, fresh) == fresh) showAlert(index, fresh);
+
     updateStatus("weather update"); //update status
 }
 
+//update weather data of city (payload was already parsed while it was received)
+void onWeather(const char *name) {
+    int index = cityIndex(name);
+    if (index < 0) return;  //skip if not our city
+
+    //use the data only if whole message was parsed (keep old data if the message is broken)
+    trace(TRACE_PARSE_START, index);
+    profileEnd(PROFILE_PARSE, profileStart() - weather_writer.cycles);
+    if (!weather_json.done()) {
+        trace(TRACE_PARSE_FAILED);
+        return;
+    }
+    trace(TRACE_PARSE_DONE);
+    requests[index].full = false;
+    commitWeather(index);
+}
+
+//patch weather data of city by delta message (payload was already parsed while it was received,
+//full data are requested when it does not match)
+void onWeatherDelta(const char *name) {
+    int index = cityIndex(name);
+    if (index < 0) return;  //skip if not our city
+
+    trace(TRACE_PARSE_START, index);
+    if (!delta_json.done() || weather_delta.foreign || weather_delta.overflow
+        || !weather[index].version || weather_delta.base != weather[index].version) {
+        profileEnd(PROFILE_PARSE, profileStart() - weather_writer.cycles);
+        trace(TRACE_PARSE_FAILED);
+        requests[index].full = true;
+        if (!requests[index].pending) scheduleRequest(index, 0);    //get full data
+        return;
+    }
+    uint32_t start = profileStart();
+    parsed_weather = weather[index];
+    applyDelta(weather_delta, parsed_weather);
+    parsed_weather.version = weather_delta.version;
+    profileEnd(PROFILE_PARSE, start - weather_writer.cycles);
+    trace(TRACE_PARSE_DONE);
+    commitWeather(index);
+}
+
+//handle new message (payload is cut to MQTT_BUFFER, weather data are streamed to the parser)
+void onMessage(char* topic, byte* payload, unsigned int length) {
+    trace(TRACE_MQTT_MESSAGE);
+
+    char config_topic[64];
+    snprintf(config_topic, sizeof(config_topic), "devices/%s/config", config.device_name);
+    if (!strcmp(topic, config_topic)) onConfig(payload, length);
+    else if (!strncmp(topic, "weather/", 8)) {
+        char *delta = strstr(topic + 8, "/delta");
+        if (delta && !delta[6]) {                       //weather/<city>/delta
+            *delta = '\0';
+            onWeatherDelta(topic + 8);
+        }
+        else onWeather(topic + 8);                      //weather/<city>
+    }
+
+    resetWeatherStream();   //every message goes through the parser, start again for the next one
+}
+
+//send device data and request missing weather after every successful connect to mqtt
+void onConnected() {
+    //publish device info
+    client.publish(("devices/" + String(config.device_name) + "/ip").c_str(), WiFi.localIP().toString().c_str(), true);
+    client.publish(("devices/" + String(config.device_name) + "/connected").c_str(), time_client.getFormattedTime().c_str(), true);
+    client.publish(("devices/" + String(config.device_name) + "/reset").c_str(), ESP.getResetReason().c_str(), true);
+
+    //upload trace of previous run until it goes through (decode with tools/trace_decode.py)
+    const uint32_t *previous = tracePrevious();
+    if (previous && publishLarge(("devices/" + String(config.device_name) + "/trace").c_str(), (const uint8_t *)previous, TRACE_WORDS * 4, true)) traceUploaded();
+
+    for (int i = 0; i < config.city_count; i++) {                       //request missing weather (after retained data had a chance to arrive)
+        if (weatherStale(i)) scheduleRequest(i, WEATHER_GRACE);
+    }
+    updateStatus("connected");                                          //update status
+}
+
 /*----(SETUP)----*/
 void setup() {
-    delay(500); //wait just because
+    traceBegin();   //keep trace of previous run, start new one
+    delay(500);     //wait just because
+
+    //configuration
+    Config defaults = {};
+    strlcpy(defaults.ssid,        default_ssid,        sizeof(defaults.ssid));
+    strlcpy(defaults.passw,       default_passw,       sizeof(defaults.passw));
+    strlcpy(defaults.mqtt_addr,   default_mqtt_addr,   sizeof(defaults.mqtt_addr));
+    strlcpy(defaults.ntp_addr,    default_ntp_addr,    sizeof(defaults.ntp_addr));
+    strlcpy(defaults.device_name, default_device_name, sizeof(defaults.device_name));
+    for (unsigned int i = 0; i < LEN(default_cities) && i < CONFIG_MAX_CITIES; i++) {
+        strlcpy(defaults.cities[i], default_cities[i], CONFIG_CITY_LEN);
+        defaults.city_count = i + 1;
+    }
+    defaults.time_offset      = default_time_offset;
+    strlcpy(defaults.timezone, default_timezone, sizeof(defaults.timezone));
+    defaults.temp_calibration = default_temp_calibration;
+    defaults.footer_time      = default_footer_time;
+    defaults.screen_time      = default_screen_time;
+    defaults.power_save       = default_power_save;
+    defaults.latitude         = default_latitude;
+    defaults.longitude        = default_longitude;
+    configLoad(config, defaults);   //load stored configuration
+    weather_slots = config.city_count;                  //weather of configured cities
+    weather = new CityWeather[weather_slots]();
+    requests = new WeatherRequest[weather_slots]();
 
     //LCD
     u8g2.begin();                           //init lcd
-    u8g2.setFont(u8g2_font_bitcasual_tr);   //set starting font
+    glyphCacheBegin(u8g2, u8g2_font_profont22_tn, "0123456789:");   //render clock digits once
+    u8g2.setFont(u8g2_font_6x12_te);        //set starting font (locale texts)
     //Wire.begin(0, 2);                       //for esp-01 when i2c is taken by sensor
 
     //AM2320 sensor
@@ -352,17 +1275,21 @@ void setup() {
 
     //wifi
     startWifi();    //connect to wifi
+    powerMode(config.power_save);
 
     //mqtt
-    client.setServer(mqtt_addr.c_str(), 1883);  //set mqtt server
-    client.setBufferSize(8192);                 //set buffer for weather data
+    client.setServer(config.mqtt_addr, 1883);   //set mqtt server
+    client.setBufferSize(MQTT_BUFFER);          //set buffer for control messages
+    client.setStream(weather_writer);           //parse weather data while receiving
     client.setCallback(onMessage);              //set message callback
 
     //NTP
+    setNtpServers();                    //set ntp servers
     time_client.begin();                //start ntp
-    time_client.setTimeOffset(7200);    //set offset
+    setTimezone();                      //set time zone rules
     delay(500);                         //wait because reasons
     time_client.forceUpdate();          //update time from ntp server
+    updateTimeOffset();                 //set local time offset
 
     //OTA
     ArduinoOTA.begin(); //init ota
@@ -370,69 +1297,181 @@ void setup() {
     ArduinoOTA.onProgress(onProgress);
     ArduinoOTA.onEnd(onEnd);
     ArduinoOTA.onError(onError);
+
+    profileBegin(); //loop timing metrics
 }
 
 void loop() {
+    traceTick();
+    uint32_t loop_start = profileStart();
+    uint32_t start;
+    bool sample = profileSample();  //measure sections running every loop only sometimes
 
-    //update footer every second
-    if (millis() - footer_timer >= SECOND) {
+    //footer tick every second
+    if (millis() - footer_timer >= config.footer_time) {
         footer_timer = millis();
-        if (screen == 1) timeScreen();                  //update time screen
-        //EDIT HERE - inside temperature sensor "calibration"
-        inside_temp = am2320.readTemperature() * 0.95;  //read temperature
-        footer();                                       //update footer
-        u8g2.sendBuffer();                              //print it
+        updateTimeOffset();                             //follow daylight saving
+        renderInvalidate(RENDER_SECOND);
+
+        //minute changed
+        long minute = time_client.getEpochTime() / 60;
+        if (minute != shown_minute) {
+            shown_minute = minute;
+            renderInvalidate(RENDER_MINUTE);
+            updateNight();                              //sunrise and sunset
+            if (screen == ALERT_SCREEN && activeAlert(city, alert_shown) != alert_shown) {
+                screen_timer = millis() - config.screen_time;   //alert ended, leave its screen now
+            }
+        }
+
+        start = profileStart();
+        float reading = am2320.readTemperature();       //sensor library only returns float (NAN when read failed)
+        if (!isnan(reading)) {
+            inside_temp = lround(reading * config.temp_calibration / 100.0);
+            inside_updated = millis();
+        }
+        char text[sizeof(inside_text)];
+        if (!inside_updated) strcpy(text, "?");         //no reading yet
+        else strcat(formatTemperature(text, inside_temp), millis() - inside_updated > INSIDE_STALE ? "?" : "C"); //last good value, marked when old
+        if (strcmp(text, inside_text)) {                //redraw only when shown value changes
+            strcpy(inside_text, text);
+            renderInvalidate(RENDER_INSIDE);
+        }
+        profileEnd(PROFILE_SENSOR, start);
+    }
+
+    //next frame of moving screen (icon animation, forecast scrolling)
+    if (framePeriod() && millis() - frame_timer >= framePeriod()) {
+        frame_timer = millis();
+        renderInvalidate(RENDER_FRAME);
     }
 
     //change screen every x seconds
-    if (millis() - screen_timer >= SECOND*4) {
+    if (millis() - screen_timer >= config.screen_time) {
         screen_timer = millis();
+        screen++;                                       //go to next screen
+        int alert = activeAlert(city, alert_shown + 1);   //alerts of the city take turns
+        if (screen == ALERT_SCREEN && alert >= 0) alert_shown = alert;
+        else if (screen >= SCREEN_COUNT) {
+            screen = 0;                                 //reset screen if above limit
+            city = (city + 1) % config.city_count;      //and show next city
+        }
+        trace(TRACE_DRAW, screen);
+        renderInvalidate(RENDER_SCREEN);
+    }
+
+    //redraw widgets with changed data, send only when something was drawn
+    start = profileStart();
+    if (render(widgets, LEN(widgets), screen)) {
+        profileEnd(PROFILE_DRAW, start);
+        frame_pending = true;
+    }
 
-        //select screen
-        switch (screen) {
-            case 0: timeScreen();     break;
-            case 1: weatherScreen();  break;
-            case 2: forecastScreen(); break;
+    //send changed rows of the frame, a few rows per loop so the transfer does not block other tasks
+    //(new alert is sent whole at once and replaces rows of previous frame still waiting)
+    if (frame_pending && (!flushBusy() || alert_urgent)) {
+        uint16_t bytes = flushStart(u8g2);              //snapshot changed rows
+        if (bytes) {
+            trace(TRACE_SEND);
+            renderSent(bytes);
         }
+        frame_pending = false;
+    }
+    if (flushBusy()) {
+        start = profileStart();
+        flushStep(u8g2, alert_urgent ? ALERT_FLUSH_BUDGET : FLUSH_BUDGET);
+        profileEnd(PROFILE_SEND, start);
+    }
+    if (!frame_pending && !flushBusy()) alert_urgent = false;
+
+    //sync time when due (interval adapts to clock stability)
+    if (time_client.isUpdateDue()) {
+        start = profileStart();
+        bool synced = time_client.forceUpdate();
+        profileEnd(PROFILE_NTP, start);
+        if (synced) {
+            trace(TRACE_NTP_SYNC, time_client.getServerIndex());
+            updateStatus("time sync " + String(time_client.getServer().name));
+        }
+        else {
+            trace(TRACE_NTP_FAILED);
+            updateStatus("time sync failed");
+        }
+        updateTimeOffset();
+    }
 
-        bubbleAnimation(screen, 1, 2, 59, 12, NULL);    //change animation
-        screen++;                                       //go to next screen
-        if (screen > 2) screen = 0;                     //reset screen if above limit
-        u8g2.sendBuffer();                              //draw display
+    //sample heap and stack
+    if (millis() - health_timer >= HEALTH_PERIOD) {
+        health_timer = millis();
+        healthSample();
+    }
+
+    //publish loop timing metrics
+    if (millis() - metrics_timer >= METRICS_PERIOD) {
+        metrics_timer = millis();
+        publishMetrics();
     }
 
-    //sync time every minute
+    //check weather data every minute
     if (millis() - sync_timer >= MINUTE) {
         sync_timer = millis();
-        time_client.forceUpdate();  //update time
-        updateStatus("time sync");  //update status
+        //request weather for cities with old data
+        for (int i = 0; i < config.city_count; i++) {
+            if (weatherStale(i) && !requests[i].pending && millis() - requests[i].requested > WEATHER_STALE / 4) scheduleRequest(i, 0);
+        }
     }
 
-    //loop and ask if connected
-    if(!client.loop()) {
-        //subscribe to required topic on connect
-        if (client.connect(device_name.c_str())) client.subscribe(("weather/" + city).c_str());
-        //else retry in 2 seconds
-        else delay(2000);
-    }
-    
-    //send device info on startup
-    if (startup) {
-        startup = false;
+    sendRequests();     //send scheduled weather requests still needed
 
-        //publish device info
-        client.publish(("devices/" + device_name + "/ip").c_str(), WiFi.localIP().toString().c_str(), true);
-        client.publish(("devices/" + device_name + "/connected").c_str(), time_client.getFormattedTime().c_str(), true);
+    //reconnect with new configuration
+    if (reconnect) {
+        reconnect = false;
+        client.disconnect();
+        client.setServer(config.mqtt_addr, 1883);
+    }
 
-        client.publish(("weather/requests/" + city).c_str(), "1", true);    //publish weather request
-        updateStatus("connected");                                          //update status
+    //loop and ask if connected
+    start = profileStart();
+    bool connected = client.loop();
+    if (sample) profileEnd(PROFILE_MQTT, start);
+    if(!connected) {
+        //subscribe to required topics on connect
+        if (client.connect(config.device_name)) {
+            trace(TRACE_MQTT_CONNECTED);
+            resetWeatherStream();   //drop message cut by disconnect
+            char topic[64];
+            for (int i = 0; i < config.city_count; i++) {
+                cityTopic(topic, sizeof(topic), "weather/", i);
+                client.subscribe(topic);
+                strlcat(topic, "/delta", sizeof(topic));
+                client.subscribe(topic);
+            }
+            snprintf(topic, sizeof(topic), "devices/%s/config", config.device_name);
+            client.subscribe(topic);
+            onConnected();
+        }
+        //else retry in 2 seconds
+        else {
+            trace(TRACE_MQTT_FAILED);
+            delay(2000);
+        }
     }
 
     //try to reconnect if disconnected
     if (!WiFi.isConnected()) {
-        startWifi();    //reconnect
-        startup = true; //update device data
+        trace(TRACE_WIFI_LOST);
+        startWifi();            //reconnect
+        client.disconnect();    //connect to mqtt again (sends device data)
     }
 
+    configLoop(config);     //write changed configuration
+
+    start = profileStart();
     ArduinoOTA.handle();    //run ota
+    if (sample) profileEnd(PROFILE_OTA, start);
+
+    profileEnd(PROFILE_LOOP, loop_start);
+
+    //sleep until next scheduled task
+    if (config.power_save) powerSleep(nextDeadline());
 }
@@ -0,0 +1,34 @@
+#include "power.h"
+#include "format.h"
+#include <ESP8266WiFi.h>
+
+static unsigned long power_slept = 0;   //ms slept since last report
+static uint32_t power_wakeups = 0;      //sleeps since last report
+static unsigned long power_since = 0;   //start of counting (millis)
+
+void powerMode(bool enabled) {
+    WiFi.setSleepMode(enabled ? WIFI_LIGHT_SLEEP : WIFI_MODEM_SLEEP);
+}
+
+void powerSleep(unsigned long ms) {
+    if (!ms) return;
+    if (ms > POWER_MAX_SLEEP) ms = POWER_MAX_SLEEP;
+
+    unsigned long start = millis();
+    delay(ms);  //sdk enters sleep while nothing else runs
+    power_slept += millis() - start;
+    power_wakeups++;
+}
+
+size_t powerReport(char *buf, size_t len) {
+    unsigned long elapsed = millis() - power_since;
+    if (!elapsed) elapsed = 1;
+    unsigned long slept = min(power_slept, elapsed);
+    size_t used = snprintf(buf, len, "power %u %u", (unsigned)((uint64_t)(elapsed - slept) * 1000 / elapsed),
+                           (unsigned)((uint64_t)power_wakeups * 3600000UL / elapsed));
+
+    power_slept = 0;
+    power_wakeups = 0;
+    power_since = millis();
+    return clampLength(used, len);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(MACROS)----*/
+#define POWER_MAX_SLEEP 1000    //longest sleep (ms), keeps mqtt and OTA responsive
+
+/*----(FUNCTIONS)----*/
+/**
+ * Switch between light sleep while idle (enabled) and default modem sleep
+ */
+void powerMode(bool enabled);
+
+/**
+ * Sleep until next deadline (capped by POWER_MAX_SLEEP). Wifi stays
+ * associated, radio and cpu sleep between beacons while idle.
+ */
+void powerSleep(unsigned long ms);
+
+/**
+ * Write awake time and wake-ups since last report and start counting again.
+ * Single line "power <awake permille> <wake-ups/h>".
+ *
+ * @return length of the report
+ */
+size_t powerReport(char *buf, size_t len);
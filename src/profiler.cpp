@@ -0,0 +1,56 @@
+#include "profiler.h"
+#include "format.h"
+
+static const char * const profile_names[PROFILE_SECTIONS] = {"loop", "draw", "send", "sensor", "ntp", "mqtt", "parse", "ota", "anim"};
+static const uint32_t profile_limits_us[PROFILE_BUCKETS - 1] = {100, 500, 1000, 5000, 10000, 50000, 100000};
+
+static ProfileStats profile_stats[PROFILE_SECTIONS];
+static uint32_t profile_limits[PROFILE_BUCKETS - 1];  //bucket limits in cycles
+static uint32_t profile_mhz = 80;
+static uint32_t profile_iteration = 0;
+static uint64_t profile_overhead = 0;                 //cycles spent in profileEnd()
+
+void profileBegin() {
+    profile_mhz = ESP.getCpuFreqMHz();
+    for (uint8_t i = 0; i < PROFILE_BUCKETS - 1; i++) profile_limits[i] = profile_limits_us[i] * profile_mhz;
+}
+
+void profileEnd(ProfileSection section, uint32_t start) {
+    uint32_t end = ESP.getCycleCount();
+    uint32_t cycles = end - start;
+    ProfileStats &stats = profile_stats[section];
+
+    stats.count++;
+    stats.total += cycles;
+    if (cycles > stats.max) stats.max = cycles;
+
+    uint8_t bucket = 0;
+    while (bucket < PROFILE_BUCKETS - 1 && cycles >= profile_limits[bucket]) bucket++;
+    if (stats.buckets[bucket] < 0xFFFF) stats.buckets[bucket]++;
+
+    profile_overhead += ESP.getCycleCount() - end;
+}
+
+bool profileSample() {
+    return (++profile_iteration % PROFILE_SAMPLE) == 0;
+}
+
+size_t profileReport(char *buf, size_t len) {
+    size_t used = 0;
+    for (uint8_t i = 0; i < PROFILE_SECTIONS && used < len; i++) {
+        ProfileStats &stats = profile_stats[i];
+        uint32_t avg = stats.count ? (uint32_t)(stats.total / stats.count / profile_mhz) : 0;
+        used += snprintf(buf + used, len - used, "%s %u %u %u %u/%u/%u/%u/%u/%u/%u/%u\n", profile_names[i],
+                         (unsigned)stats.count, (unsigned)avg, (unsigned)(stats.max / profile_mhz),
+                         stats.buckets[0], stats.buckets[1], stats.buckets[2], stats.buckets[3],
+                         stats.buckets[4], stats.buckets[5], stats.buckets[6], stats.buckets[7]);
+    }
+
+    //overhead against total loop time
+    uint64_t loop = profile_stats[PROFILE_LOOP].total;
+    if (used < len) used += snprintf(buf + used, len - used, "oh %u", loop ? (unsigned)(profile_overhead * 1000 / loop) : 0);
+
+    memset(profile_stats, 0, sizeof(profile_stats));
+    profile_overhead = 0;
+    return clampLength(used, len);
+}
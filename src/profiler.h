@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(MACROS)----*/
+#define PROFILE_BUCKETS 8       //latency histogram buckets (see profile_limits_us)
+#define PROFILE_SAMPLE  16      //sections running every loop are measured in every n-th loop only
+
+/*----(ENUMS)----*/
+//measured parts of the main loop
+enum ProfileSection : uint8_t {
+    PROFILE_LOOP,       //whole loop iteration
+    PROFILE_DRAW,       //drawing into buffer
+    PROFILE_SEND,       //sendBuffer
+    PROFILE_SENSOR,     //am2320 read
+    PROFILE_NTP,        //time sync
+    PROFILE_MQTT,       //client.loop (sampled)
+    PROFILE_PARSE,      //weather message parsing
+    PROFILE_OTA,        //ArduinoOTA.handle (sampled)
+    PROFILE_ANIM,       //icon animation and forecast scroll frames (part of draw)
+    PROFILE_SECTIONS
+};
+
+/*----(STRUCT)----*/
+typedef struct {
+    uint32_t count;                     //number of measurements
+    uint64_t total;                     //sum of cycles
+    uint32_t max;                       //longest measurement (cycles)
+    uint16_t buckets[PROFILE_BUCKETS];  //latency histogram
+} ProfileStats;
+
+/*----(FUNCTIONS)----*/
+/**
+ * Prepare bucket limits for current cpu frequency
+ */
+void profileBegin();
+
+/**
+ * @return start of measured section
+ */
+inline uint32_t profileStart() {
+    return ESP.getCycleCount();
+}
+
+/**
+ * Record section measured from start
+ */
+void profileEnd(ProfileSection section, uint32_t start);
+
+/**
+ * @return true if sections running every loop should be measured in this loop
+ */
+bool profileSample();
+
+/**
+ * Write compact report of collected data and start collecting again.
+ * Line per section "name count avg_us max_us b0/b1/../b7", last line "oh <permille of loop time>".
+ *
+ * @return length of the report
+ */
+size_t profileReport(char *buf, size_t len);
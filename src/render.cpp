@@ -0,0 +1,50 @@
+#include "render.h"
+#include "format.h"
+
+static uint8_t render_invalid = RENDER_ALL; //changed data since last render
+static uint32_t render_redraws = 0;         //redrawn widgets since last report
+static uint32_t render_sends = 0;           //sent buffers since last report
+static uint32_t render_bytes = 0;           //sent bytes since last report
+static unsigned long render_since = 0;      //start of counting (millis)
+
+void renderInvalidate(uint8_t dependencies) {
+    render_invalid |= dependencies;
+}
+
+bool render(const Widget *widgets, uint8_t count, int8_t screen) {
+    if (!render_invalid) return false;
+
+    bool drawn = false;
+    for (uint8_t i = 0; i < count; i++) {
+        const Widget &widget = widgets[i];
+        if (!(widget.depends & render_invalid)) continue;
+        if (widget.screen >= 0 && widget.screen != screen) continue;
+        widget.draw();
+        render_redraws++;
+        drawn = true;
+    }
+    render_invalid = 0;
+    return drawn;
+}
+
+bool renderPending() {
+    return render_invalid != 0;
+}
+
+void renderSent(uint16_t bytes) {
+    render_sends++;
+    render_bytes += bytes;
+}
+
+size_t renderReport(char *buf, size_t len) {
+    unsigned long elapsed = millis() - render_since;
+    if (!elapsed) elapsed = 1;
+    size_t used = snprintf(buf, len, "render %u %u %u",
+                           (unsigned)((uint64_t)render_redraws * 3600000UL / elapsed),
+                           (unsigned)((uint64_t)render_sends * 3600000UL / elapsed),
+                           (unsigned)((uint64_t)render_bytes * 3600000UL / elapsed));
+
+    render_redraws = render_sends = render_bytes = 0;
+    render_since = millis();
+    return clampLength(used, len);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(ENUMS)----*/
+//data the widgets depend on
+enum RenderDependency : uint8_t {
+    RENDER_SECOND  = 1 << 0,    //clock seconds (footer tick)
+    RENDER_MINUTE  = 1 << 1,    //clock minutes
+    RENDER_INSIDE  = 1 << 2,    //inside temperature
+    RENDER_WEATHER = 1 << 3,    //weather data of shown city
+    RENDER_SCREEN  = 1 << 4,    //shown screen or city
+    RENDER_FRAME   = 1 << 5,    //animation frame
+    RENDER_ALL     = 0xFF       //whole display (after something else drew over it)
+};
+
+/*----(STRUCT)----*/
+typedef struct {
+    uint8_t depends;    //RenderDependency bits
+    int8_t screen;      //screen showing the widget (-1 = every screen)
+    void (*draw)();     //draws the widget (clearing its own area)
+} Widget;
+
+/*----(FUNCTIONS)----*/
+/**
+ * Mark data as changed, widgets depending on it are redrawn on next render()
+ */
+void renderInvalidate(uint8_t dependencies);
+
+/**
+ * Redraw invalidated widgets of the shown screen
+ *
+ * @return true if anything was drawn (buffer has to be sent)
+ */
+bool render(const Widget *widgets, uint8_t count, int8_t screen);
+
+/**
+ * @return true if some data changed since last render()
+ */
+bool renderPending();
+
+/**
+ * Count buffer bytes sent to the display
+ */
+void renderSent(uint16_t bytes);
+
+/**
+ * Write rates since last report and start counting again.
+ * Single line "render <widget redraws/h> <sends/h> <bytes sent/h>".
+ *
+ * @return length of the report
+ */
+size_t renderReport(char *buf, size_t len);
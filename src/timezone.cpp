@@ -0,0 +1,184 @@
+#include "timezone.h"
+
+//Howard Hinnant's days_from_civil
+long daysFromCivil(int year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    long era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yoe = (unsigned)(year - era * 400);                              //[0, 399]
+    unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;  //[0, 365]
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                     //[0, 146096]
+    return era * 146097 + (long)doe - 719468;
+}
+
+//Howard Hinnant's civil_from_days
+void civilFromDays(long days, int &year, unsigned &month, unsigned &day) {
+    days += 719468;
+    long era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned doe = (unsigned)(days - era * 146097);                           //[0, 146096]
+    unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;     //[0, 399]
+    unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);                   //[0, 365]
+    unsigned mp = (5 * doy + 2) / 153;                                        //[0, 11]
+    day = doy - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = (int)(yoe + era * 400) + (month <= 2);
+}
+
+static int yearOf(long long utc) {
+    long days = (long)(utc / 86400);
+    int year = 1970 + days / 366;
+    while (daysFromCivil(year + 1, 1, 1) <= days) year++;
+    return year;
+}
+
+//zone name ("CET" or "<+03>")
+static const char *parseName(const char *p) {
+    const char *start = p;
+    if (*p == '<') {
+        while (*p && *p != '>') p++;
+        return (*p == '>') ? p + 1 : NULL;
+    }
+    while ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z')) p++;
+    return (p - start >= 3) ? p : NULL;
+}
+
+//time ([+-]hh[:mm[:ss]])
+static const char *parseTime(const char *p, long *out) {
+    long sign = 1;
+    if (*p == '+' || *p == '-') sign = (*p++ == '-') ? -1 : 1;
+    if (*p < '0' || *p > '9') return NULL;
+
+    long value = 0;
+    long unit = 3600;
+    while (unit) {
+        long part = 0;
+        while (*p >= '0' && *p <= '9') part = part * 10 + (*p++ - '0');
+        value += part * unit;
+        if (*p != ':' || unit == 1) break;
+        p++;
+        unit /= 60;
+    }
+    *out = sign * value;
+    return p;
+}
+
+//transition rule (Mm.w.d[/time])
+static const char *parseRule(const char *p, TzRule *rule) {
+    if (*p++ != 'M') return NULL;
+    int month = strtol(p, (char **)&p, 10);
+    if (*p++ != '.') return NULL;
+    int week = strtol(p, (char **)&p, 10);
+    if (*p++ != '.') return NULL;
+    int day = strtol(p, (char **)&p, 10);
+    if (month < 1 || month > 12 || week < 1 || week > 5 || day < 0 || day > 6) return NULL;
+
+    rule->month = month;
+    rule->week  = week;
+    rule->day   = day;
+    rule->time  = 7200;     //default 02:00
+    if (*p == '/') p = parseTime(p + 1, &rule->time);
+    return p;
+}
+
+void Timezone::setOffset(long offset) {
+    _std_offset = offset;
+    _dst_offset = offset;
+    _has_dst = false;
+    _valid_from = 1;    //invalidate cache
+    _valid_until = 0;
+}
+
+bool Timezone::set(const char *tz) {
+    long std_offset, dst_offset;
+    TzRule start, end;
+    bool has_dst = false;
+
+    //standard time
+    const char *p = parseName(tz);
+    if (!p) return false;
+    p = parseTime(p, &std_offset);
+    if (!p) return false;
+    std_offset = -std_offset;   //POSIX offsets are west of UTC
+    dst_offset = std_offset + 3600;
+
+    //daylight saving time
+    if (*p) {
+        p = parseName(p);
+        if (!p) return false;
+        if (*p && *p != ',') {
+            p = parseTime(p, &dst_offset);
+            if (!p) return false;
+            dst_offset = -dst_offset;
+        }
+        if (*p++ != ',') return false;
+        p = parseRule(p, &start);
+        if (!p || *p++ != ',') return false;
+        p = parseRule(p, &end);
+        if (!p || *p) return false;
+        has_dst = true;
+    }
+
+    _std_offset = std_offset;
+    _dst_offset = has_dst ? dst_offset : std_offset;
+    _has_dst = has_dst;
+    _start = start;
+    _end = end;
+    _valid_from = 1;    //invalidate cache
+    _valid_until = 0;
+    return true;
+}
+
+//UTC time of transition in given year
+long long Timezone::transition(int year, const TzRule &rule, long offset) {
+    static const uint8_t month_days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int length = month_days[rule.month - 1];
+    if (rule.month == 2 && !(year % 4) && ((year % 100) || !(year % 400))) length++;
+
+    //first wanted weekday of month, then wanted week
+    long first = daysFromCivil(year, rule.month, 1);
+    int day = (rule.day - (first + 4) % 7 + 7) % 7 + (rule.week - 1) * 7;
+    while (day >= length) day -= 7;
+
+    return (long long)(first + day) * 86400 + rule.time - offset;
+}
+
+void Timezone::update(unsigned long utc) {
+    if (!_has_dst) {
+        _cached = _std_offset;
+        _cached_dst = false;
+        _valid_from = 0;
+        _valid_until = 0x7FFFFFFFFFFFLL;
+        return;
+    }
+
+    //transitions around current year (in order), find the one we are after
+    int year = yearOf(utc);
+    long long times[6];
+    bool states[6];     //dst after the transition
+    uint8_t count = 0;
+    for (int y = year - 1; y <= year + 1; y++) {
+        long long start = transition(y, _start, _std_offset);
+        long long end   = transition(y, _end,   _dst_offset);
+        bool start_first = start < end;
+        times[count] = start_first ? start : end;
+        states[count++] = start_first;
+        times[count] = start_first ? end : start;
+        states[count++] = !start_first;
+    }
+
+    uint8_t i = 0;
+    while (i < 5 && times[i + 1] <= (long long)utc) i++;
+    _cached_dst  = states[i];
+    _cached      = _cached_dst ? _dst_offset : _std_offset;
+    _valid_from  = times[i];
+    _valid_until = times[i + 1];
+}
+
+long Timezone::offset(unsigned long utc) {
+    if ((long long)utc < _valid_from || (long long)utc >= _valid_until) update(utc);
+    return _cached;
+}
+
+bool Timezone::dst(unsigned long utc) {
+    offset(utc);
+    return _cached_dst;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(STRUCT)----*/
+//daylight saving transition in "Mm.w.d/time" form
+typedef struct {
+    uint8_t month;  //1-12
+    uint8_t week;   //1-5 (5 = last week of month)
+    uint8_t day;    //0-6 (0 = Sunday)
+    long time;      //local time of the transition (s after midnight)
+} TzRule;
+
+/*----(CLASS)----*/
+//POSIX TZ ("CET-1CEST,M3.5.0,M10.5.0/3") local time offset with transition cache.
+//The rule is parsed once, the offset is recomputed only when crossing a transition.
+class Timezone {
+  public:
+    /**
+     * Set fixed offset (no daylight saving)
+     */
+    void setOffset(long offset);
+
+    /**
+     * Set rules from POSIX TZ string (only "Mm.w.d" transitions are supported)
+     *
+     * @return false if the string is not valid (the rules are not changed)
+     */
+    bool set(const char *tz);
+
+    /**
+     * @return offset from UTC (s) at given UTC time
+     */
+    long offset(unsigned long utc);
+
+    /**
+     * @return true if daylight saving time is in effect at given UTC time
+     */
+    bool dst(unsigned long utc);
+
+  private:
+    long   _std_offset = 0;     //offset from UTC (s)
+    long   _dst_offset = 0;
+    bool   _has_dst    = false;
+    TzRule _start;              //daylight saving start (in standard time)
+    TzRule _end;                //daylight saving end (in daylight saving time)
+
+    //cache - offset is valid between two transitions
+    long long _valid_from  = 1;
+    long long _valid_until = 0;
+    long _cached = 0;
+    bool _cached_dst = false;
+
+    long long transition(int year, const TzRule &rule, long offset);
+    void update(unsigned long utc);
+};
+
+/**
+ * @return days since 1.1.1970 for given date
+ */
+long daysFromCivil(int year, unsigned month, unsigned day);
+
+/**
+ * Convert days since 1.1.1970 to date
+ */
+void civilFromDays(long days, int &year, unsigned &month, unsigned &day);
@@ -0,0 +1,33 @@
+#include "trace.h"
+
+uint32_t trace_head = 0;
+uint16_t trace_time = 0;
+
+static uint32_t trace_previous[TRACE_WORDS];
+static bool trace_pending = false;
+
+void traceBegin() {
+    //keep previous trace if there is a valid one
+    uint16_t boot = 0;
+    if (TRACE_RTC[0] == TRACE_MAGIC && (TRACE_RTC[1] & 0xFF) < TRACE_SIZE) {
+        for (uint8_t i = 0; i < TRACE_WORDS; i++) trace_previous[i] = TRACE_RTC[i];
+        trace_pending = true;
+        boot = (trace_previous[1] >> 16) + 1;
+    }
+
+    //start new trace
+    trace_head = (uint32_t)boot << 16;
+    TRACE_RTC[1] = trace_head;
+    TRACE_RTC[0] = TRACE_MAGIC;
+
+    traceTick();
+    trace(TRACE_BOOT, ESP.getResetInfoPtr()->reason);
+}
+
+const uint32_t *tracePrevious() {
+    return trace_pending ? trace_previous : NULL;
+}
+
+void traceUploaded() {
+    trace_pending = false;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*----(MACROS)----*/
+//RTC user memory survives everything but power loss, first 128 bytes are used by OTA
+#ifdef ARDUINO
+#define TRACE_RTC    ((volatile uint32_t *)(0x60001200 + 128))
+#else
+#define TRACE_RTC    (ESP.rtc_memory + 32)              //host builds (native tests) use RTC memory of the ESP stand-in
+#endif
+#define TRACE_WORDS  96                 //rest of RTC user memory
+#define TRACE_SIZE   (TRACE_WORDS - 2)  //events in ring buffer
+#define TRACE_MAGIC  0x54524345         //"TRCE"
+
+/*----(ENUMS)----*/
+//event codes (keep in sync with tools/trace_decode.py)
+enum TraceEvent : uint8_t {
+    TRACE_BOOT = 1,         //arg - reset reason
+    TRACE_WIFI_CONNECTING,
+    TRACE_WIFI_CONNECTED,
+    TRACE_WIFI_LOST,
+    TRACE_WIFI_RESTART,     //restart after failed connection
+    TRACE_MQTT_CONNECTED,
+    TRACE_MQTT_FAILED,
+    TRACE_MQTT_MESSAGE,
+    TRACE_NTP_SYNC,         //arg - server index
+    TRACE_NTP_FAILED,
+    TRACE_PARSE_START,      //arg - city index
+    TRACE_PARSE_DONE,
+    TRACE_PARSE_FAILED,
+    TRACE_DRAW,             //arg - screen
+    TRACE_SEND,
+    TRACE_CONFIG,
+    TRACE_OTA_START,
+    TRACE_OTA_END,
+    TRACE_OTA_ERROR,        //arg - error
+    TRACE_WIFI_FALLBACK,    //new credentials failed, stored ones are used
+};
+
+/*----(VARIABLES)----*/
+extern uint32_t trace_head; //next index (bits 0-7), wrapped (bit 8), boot count (bits 16-31)
+extern uint16_t trace_time; //time of events in this loop (64ms units)
+
+/*----(FUNCTIONS)----*/
+/**
+ * Keep previous trace for upload and start new one (call first thing in setup)
+ */
+void traceBegin();
+
+/**
+ * Update time of recorded events (call at the start of every loop)
+ */
+inline void traceTick() {
+    trace_time = millis() >> 6;
+}
+
+/**
+ * Record event (word stored to RTC memory, no allocation)
+ */
+inline void trace(TraceEvent event, uint8_t arg = 0) {
+    uint8_t next = trace_head & 0xFF;
+    TRACE_RTC[2 + next] = ((uint32_t)event << 24) | ((uint32_t)arg << 16) | trace_time;
+    if (++next >= TRACE_SIZE) trace_head = (trace_head & ~0xFFUL) | 0x100;
+    else                      trace_head = (trace_head & ~0xFFUL) | next;
+    TRACE_RTC[1] = trace_head;
+}
+
+/**
+ * @return trace of previous run (NULL if there is none or it was uploaded)
+ *         as TRACE_WORDS little endian words: magic, head, events
+ */
+const uint32_t *tracePrevious();
+
+/**
+ * Mark previous trace as uploaded
+ */
+void traceUploaded();
@@ -0,0 +1,5 @@
+#pragma once
+
+//Host stand-in of the Adafruit unified sensor library (nothing of it is used directly).
+
+#include <Arduino.h>
@@ -0,0 +1,214 @@
+#pragma once
+
+//Host stand-in of the ESP8266 Arduino core for native tests and benchmarks.
+//Only what the modules in src/ use is provided. Time is virtual: it moves only when
+//tests advance native_time_us, by delay() and, with native_cpu_scale set, by host CPU
+//time scaled to the ESP8266 (benchmarks that run the firmware loop).
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+/*----(TYPES)----*/
+typedef uint8_t byte;
+typedef bool boolean;
+
+/*----(MACROS)----*/
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(p)  (*(const uint8_t *)(p))
+#define pgm_read_word(p)  (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p)   (*(void * const *)(p))
+#define memcpy_P  memcpy
+#define strlen_P  strlen
+#define strcmp_P  strcmp
+#define strncpy_P strncpy
+
+#define constrain(x, low, high) ((x) < (low) ? (low) : ((x) > (high) ? (high) : (x)))
+using std::min;
+using std::max;
+
+/*----(TIME)----*/
+inline uint64_t native_time_us = 0;     //virtual clock (us)
+inline double native_cpu_scale = 0;     //host CPU time charged to the clock (0 = off)
+
+inline uint64_t nativeClock() {
+    static std::chrono::steady_clock::time_point mark = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (native_cpu_scale > 0) {
+        native_time_us += (uint64_t)(std::chrono::duration<double, std::micro>(now - mark).count() * native_cpu_scale);
+    }
+    mark = now;
+    return native_time_us;
+}
+
+inline unsigned long millis() { return nativeClock() / 1000; }
+inline unsigned long micros() { return nativeClock(); }
+inline void delay(unsigned long ms) { nativeClock(); native_time_us += ms * 1000ULL; }
+inline void delayMicroseconds(unsigned int us) { nativeClock(); native_time_us += us; }
+inline void yield() {}
+
+/*----(FUNCTIONS)----*/
+inline long random(long max_value) { return max_value > 0 ? rand() % max_value : 0; }
+inline long random(long min_value, long max_value) { return min_value + random(max_value - min_value); }
+inline void randomSeed(unsigned long seed) { srand(seed); }
+inline uint16_t word(uint8_t high, uint8_t low) { return (high << 8) | low; }
+inline char *itoa(int value, char *buf, int base) {
+    std::string digits;
+    unsigned magnitude = value < 0 && base == 10 ? -(unsigned)value : (unsigned)value;
+    do digits.insert(digits.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % base]); while (magnitude /= base);
+    if (value < 0 && base == 10) digits.insert(digits.begin(), '-');
+    return strcpy(buf, digits.c_str());
+}
+
+#if !(defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 38)) && !defined(__APPLE__)
+inline size_t strlcpy(char *dst, const char *src, size_t size) {
+    size_t len = strlen(src);
+    if (size) {
+        size_t copy = (len < size - 1) ? len : size - 1;
+        memcpy(dst, src, copy);
+        dst[copy] = '\0';
+    }
+    return len;
+}
+
+inline size_t strlcat(char *dst, const char *src, size_t size) {
+    size_t len = strnlen(dst, size);
+    return len + strlcpy(dst + len, src, size - len);
+}
+#endif
+
+/*----(CLASSES)----*/
+//Arduino String on top of std::string (used by NTPClient and main.cpp)
+class String {
+  public:
+    String() {}
+    String(const char *text) : _s(text ? text : "") {}
+    String(const std::string &text) : _s(text) {}
+    String(int value) : _s(std::to_string(value)) {}
+    String(unsigned value) : _s(std::to_string(value)) {}
+    String(long value) : _s(std::to_string(value)) {}
+    String(unsigned long value) : _s(std::to_string(value)) {}
+
+    const char *c_str() const { return _s.c_str(); }
+    unsigned length() const { return _s.size(); }
+    String substring(unsigned from, unsigned to) const { return _s.substr(from, to - from); }
+    long toInt() const { return atol(_s.c_str()); }
+    char operator[](unsigned i) const { return _s[i]; }
+    bool operator==(const String &other) const { return _s == other._s; }
+    bool operator!=(const String &other) const { return _s != other._s; }
+    String &operator+=(const String &other) { _s += other._s; return *this; }
+    friend String operator+(const String &a, const String &b) { return a._s + b._s; }
+
+  private:
+    std::string _s;
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        for (size_t i = 0; i < size; i++) write(buffer[i]);
+        return size;
+    }
+    size_t print(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+    size_t print(const String &text) { return print(text.c_str()); }
+    size_t println(const char *text = "") { return print(text) + print("\n"); }
+    size_t println(const String &text) { return println(text.c_str()); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+inline size_t Print::printf(const char *format, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return write((const uint8_t *)buf, min(len, (int)sizeof(buf) - 1));
+}
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+};
+
+//serial output is dropped unless native_serial is set
+inline bool native_serial = false;
+class HardwareSerial : public Stream {
+  public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { if (native_serial) fputc(c, stderr); return 1; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+};
+inline HardwareSerial Serial;
+
+class IPAddress {
+  public:
+    String toString() const { return "127.0.0.1"; }
+};
+
+struct rst_info {
+    uint32_t reason;
+    uint32_t exccause;
+    uint32_t epc1, epc2, epc3, excvaddr, depc;
+};
+
+//heap figures of the instrumented allocator (NativeHeap.h) when a suite uses it
+inline void (*native_heap_stats)(uint32_t &free_heap, uint32_t &max_block, uint8_t &fragmentation) = nullptr;
+
+//ESP object, heap and stack figures are plain members tests can set (heap ones are
+//overwritten by the instrumented allocator)
+class EspClass {
+  public:
+    uint32_t free_heap = 40000;
+    uint32_t max_free_block = 30000;
+    uint8_t  heap_fragmentation = 5;
+    uint32_t free_cont_stack = 3000;
+    rst_info reset_info = {};
+    uint32_t rtc_memory[128] = {};
+
+    void restart() { abort(); }
+    uint32_t getFreeHeap() { refreshHeap(); return free_heap; }
+    uint32_t getMaxFreeBlockSize() { refreshHeap(); return max_free_block; }
+    uint8_t getHeapFragmentation() { refreshHeap(); return heap_fragmentation; }
+    uint32_t getFreeContStack() { return free_cont_stack; }
+    void resetFreeContStack() {}
+    String getResetReason() { return "External System"; }
+    rst_info *getResetInfoPtr() { return &reset_info; }
+    uint32_t getCycleCount() { return (uint32_t)(micros() * 80); }
+    uint32_t getCpuFreqMHz() { return 80; }
+    uint32_t getChipId() { return 0x123456; }
+    bool rtcUserMemoryRead(uint32_t offset, uint32_t *data, size_t size) {
+        if (offset * 4 + size > sizeof(rtc_memory)) return false;
+        memcpy(data, rtc_memory + offset, size);
+        return true;
+    }
+    bool rtcUserMemoryWrite(uint32_t offset, uint32_t *data, size_t size) {
+        if (offset * 4 + size > sizeof(rtc_memory)) return false;
+        memcpy(rtc_memory + offset, data, size);
+        return true;
+    }
+
+  private:
+    void refreshHeap() {
+        if (native_heap_stats) native_heap_stats(free_heap, max_free_block, heap_fragmentation);
+    }
+};
+inline EspClass ESP;
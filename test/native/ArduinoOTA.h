@@ -0,0 +1,23 @@
+#pragma once
+
+//Host stand-in of ArduinoOTA (no updates arrive, handlers are only stored).
+
+#include <Arduino.h>
+
+enum ota_error_t { OTA_AUTH_ERROR, OTA_BEGIN_ERROR, OTA_CONNECT_ERROR, OTA_RECEIVE_ERROR, OTA_END_ERROR };
+
+class ArduinoOTAClass {
+  public:
+    void (*start)() = nullptr;
+    void (*end)() = nullptr;
+    void (*progress)(size_t, size_t) = nullptr;
+    void (*error)(ota_error_t) = nullptr;
+
+    void begin() {}
+    void handle() {}
+    void onStart(void (*handler)()) { start = handler; }
+    void onEnd(void (*handler)()) { end = handler; }
+    void onProgress(void (*handler)(size_t, size_t)) { progress = handler; }
+    void onError(void (*handler)(ota_error_t)) { error = handler; }
+};
+inline ArduinoOTAClass ArduinoOTA;
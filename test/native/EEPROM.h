@@ -0,0 +1,21 @@
+#pragma once
+
+//Host stand-in of the ESP8266 EEPROM emulation (one flash sector in RAM).
+
+#include <Arduino.h>
+
+class EEPROMClass {
+  public:
+    uint8_t  data[4096] = {};   //sector content (tests may prepare images here)
+    size_t   size = 0;
+    unsigned commits = 0;       //number of flash writes
+
+    void begin(size_t bytes) { size = min(bytes, sizeof(data)); }
+    uint8_t read(int address) { return data[address]; }
+    void write(int address, uint8_t value) { data[address] = value; }
+    bool commit() { commits++; return true; }
+    void end() {}
+    uint8_t *getDataPtr() { return data; }
+    const uint8_t *getConstDataPtr() const { return data; }
+};
+inline EEPROMClass EEPROM;
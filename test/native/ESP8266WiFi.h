@@ -0,0 +1,44 @@
+#pragma once
+
+//Host stand-in of the ESP8266 WiFi library. The station connects at once when the
+//password matches native_wifi_passw (any password when it is NULL).
+
+#include <Arduino.h>
+
+enum WiFiMode_t { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 };
+enum wl_status_t { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_CONNECT_FAILED = 4, WL_DISCONNECTED = 6 };
+enum WiFiSleepType_t { WIFI_NONE_SLEEP = 0, WIFI_LIGHT_SLEEP = 1, WIFI_MODEM_SLEEP = 2 };
+
+inline const char *native_wifi_passw = NULL;
+
+class WiFiClass {
+  public:
+    char ssid[33] = "";
+    char passw[65] = "";
+    bool connected = false;
+    WiFiSleepType_t sleep_mode = WIFI_MODEM_SLEEP;
+
+    void mode(WiFiMode_t) {}
+    void persistent(bool) {}
+    void begin(const char *new_ssid, const char *new_passw) {
+        strlcpy(ssid, new_ssid, sizeof(ssid));
+        strlcpy(passw, new_passw, sizeof(passw));
+        connected = !native_wifi_passw || !strcmp(passw, native_wifi_passw);
+    }
+    void disconnect() { connected = false; }
+    wl_status_t status() { return connected ? WL_CONNECTED : WL_DISCONNECTED; }
+    bool isConnected() { return connected; }
+    IPAddress localIP() { return IPAddress(); }
+    bool setSleepMode(WiFiSleepType_t type, uint8_t = 0) { sleep_mode = type; return true; }
+};
+inline WiFiClass WiFi;
+
+//network client (the firmware only hands it to PubSubClient)
+class Client : public Stream {
+  public:
+    size_t write(uint8_t) override { return 1; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+};
+class WiFiClient : public Client {};
@@ -0,0 +1,96 @@
+#pragma once
+
+//Scripted NTP servers behind the UDP interface for NTPClient tests and benchmarks.
+//Each server answers after its round trip on the virtual clock (or never when down) with
+//the reference time native_ntp_epoch_ms, echoing the request's transmit timestamp.
+//forge() may rewrite, drop or add datagrams of an answer to test packet validation.
+
+#include <Udp.h>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+struct FakeNtpServer {
+    unsigned long rtt = 20;     //round trip (ms)
+    bool up = true;
+    unsigned long requests = 0;
+};
+
+inline uint64_t native_ntp_epoch_ms = 1700000000000ULL;     //reference UTC at virtual time 0
+
+class FakeNtpUdp : public UDP {
+  public:
+    std::map<std::string, FakeNtpServer> servers;
+    std::function<void(std::vector<std::vector<uint8_t>> &packets)> forge;    //datagrams of every answer (the real one first)
+
+    //reference NTP timestamp (seconds since 1900 and 32-bit fraction) at given virtual ms
+    static void timestamp(uint64_t ms, uint8_t *out) {
+        uint64_t utc = native_ntp_epoch_ms + ms;
+        uint32_t secs = (uint32_t)(utc / 1000 + 2208988800ULL);     //wraps in 2036 (era 1)
+        uint32_t fraction = (uint32_t)(((utc % 1000) << 32) / 1000);
+        for (int i = 0; i < 4; i++) {
+            out[i] = secs >> (24 - 8 * i);
+            out[4 + i] = fraction >> (24 - 8 * i);
+        }
+    }
+
+    uint8_t begin(uint16_t) override { return 1; }
+    void stop() override {}
+    int beginPacket(const char *host, uint16_t) override {
+        _host = host;
+        _request.clear();
+        return 1;
+    }
+    size_t write(uint8_t c) override { _request.push_back(c); return 1; }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        _request.insert(_request.end(), buffer, buffer + size);
+        return size;
+    }
+    int endPacket() override {
+        FakeNtpServer &server = servers[_host];
+        server.requests++;
+        if (server.up && _request.size() >= 48) {
+            std::vector<std::vector<uint8_t>> packets(1, std::vector<uint8_t>(48, 0));
+            std::vector<uint8_t> &packet = packets[0];
+            packet[0] = 0x24;   //LI 0, version 4, mode server
+            packet[1] = 2;      //stratum
+            packet[16] = 1;     //reference timestamp
+            memcpy(&packet[24], &_request[40], 8);      //originate = our transmit
+            timestamp(millis() + server.rtt / 2, &packet[40]);
+            if (forge) forge(packets);
+            for (const std::vector<uint8_t> &datagram : packets) _answers.push_back({millis() + server.rtt, datagram});
+        }
+        return 1;
+    }
+    int parsePacket() override {
+        for (size_t i = 0; i < _answers.size(); i++) {
+            if (_answers[i].due <= millis()) {
+                _packet = _answers[i].packet;
+                _answers.erase(_answers.begin() + i);
+                return _packet.size();
+            }
+        }
+        _packet.clear();
+        return 0;
+    }
+    int read(unsigned char *buffer, size_t len) override {
+        len = min(len, _packet.size());
+        memcpy(buffer, _packet.data(), len);
+        return len;
+    }
+    int available() override { return _packet.size(); }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    void flush() override { _packet.clear(); }
+
+  private:
+    struct Answer {
+        unsigned long due;
+        std::vector<uint8_t> packet;
+    };
+    std::string _host;
+    std::vector<uint8_t> _request;
+    std::vector<uint8_t> _packet;
+    std::vector<Answer> _answers;
+};
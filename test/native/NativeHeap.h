@@ -0,0 +1,126 @@
+#pragma once
+
+//Instrumented allocator for host soak tests. Global new/delete (and so String and the
+//containers of the stand-ins) allocate from an arena of ESP8266 heap size, first fit in
+//8 byte blocks with a 4 byte header like umm_malloc. ESP.getFreeHeap(), getMaxFreeBlockSize()
+//and getHeapFragmentation() then report the arena with the core's formulas, so health
+//samples of a host run show the same exhaustion and fragmentation as the device would.
+//Include in exactly one file of a test suite (it defines the global allocation functions).
+
+#include <Arduino.h>
+#include <new>
+
+#ifndef NATIVE_HEAP_SIZE
+#define NATIVE_HEAP_SIZE 40000      //free heap of the station after boot (bytes)
+#endif
+#define NATIVE_HEAP_BLOCK 8
+#define NATIVE_HEAP_BLOCKS (NATIVE_HEAP_SIZE / NATIVE_HEAP_BLOCK)
+
+//all zero at start (constant initialized, usable by allocations of other static constructors)
+struct NativeHeap {
+    alignas(16) uint8_t arena[NATIVE_HEAP_SIZE];
+    uint16_t length[NATIVE_HEAP_BLOCKS];    //blocks of allocation starting at the block (0 = free)
+    bool used[NATIVE_HEAP_BLOCKS];
+
+    size_t used_blocks;
+    size_t peak_blocks;                     //most blocks in use at once
+    unsigned long allocations;              //successful allocations
+    unsigned long failures;                 //allocations that did not fit
+
+    void *allocate(size_t size) {
+        size_t blocks = (size + 4 + NATIVE_HEAP_BLOCK - 1) / NATIVE_HEAP_BLOCK;
+        size_t run = 0;
+        for (size_t i = 0; i < NATIVE_HEAP_BLOCKS; i++) {
+            if (used[i]) {
+                run = 0;
+                continue;
+            }
+            if (run == 0 && i % 2) continue;     //payloads 16 byte aligned for the host
+            if (++run < blocks) continue;
+            size_t start = i + 1 - blocks;
+            for (size_t j = start; j <= i; j++) used[j] = true;
+            length[start] = blocks;
+            used_blocks += blocks;
+            allocations++;
+            if (used_blocks > peak_blocks) peak_blocks = used_blocks;
+            return arena + start * NATIVE_HEAP_BLOCK;
+        }
+        failures++;
+        return nullptr;
+    }
+
+    bool owns(const void *ptr) {
+        return ptr >= (const void *)arena && ptr < (const void *)(arena + sizeof(arena));
+    }
+
+    void release(void *ptr) {
+        size_t start = ((uint8_t *)ptr - arena) / NATIVE_HEAP_BLOCK;
+        for (size_t j = start; j < start + length[start]; j++) used[j] = false;
+        used_blocks -= length[start];
+        length[start] = 0;
+    }
+
+    uint32_t freeHeap() {
+        return (NATIVE_HEAP_BLOCKS - used_blocks) * NATIVE_HEAP_BLOCK;
+    }
+
+    //lowest free heap so far (true low watermark, samples may miss it)
+    uint32_t lowestFreeHeap() {
+        return (NATIVE_HEAP_BLOCKS - peak_blocks) * NATIVE_HEAP_BLOCK;
+    }
+
+    //free heap, largest free block and fragmentation (100 - sqrt(sum of free block sizes squared) * 100 / free)
+    void stats(uint32_t &free_heap, uint32_t &max_block, uint8_t &fragmentation) {
+        uint64_t squares = 0;
+        uint32_t run = 0;
+        free_heap = max_block = 0;
+        for (size_t i = 0; i <= NATIVE_HEAP_BLOCKS; i++) {
+            if (i < NATIVE_HEAP_BLOCKS && !used[i]) {
+                run += NATIVE_HEAP_BLOCK;
+                continue;
+            }
+            free_heap += run;
+            if (run > max_block) max_block = run;
+            squares += (uint64_t)run * run;
+            run = 0;
+        }
+        fragmentation = free_heap ? 100 - (uint8_t)(sqrt((double)squares) * 100 / free_heap) : 0;
+        if (max_block > 4) max_block -= 4;      //usable size (header of the allocation excluded)
+    }
+};
+
+inline NativeHeap native_heap;
+
+static bool native_heap_installed = [] {
+    native_heap_stats = [](uint32_t &free_heap, uint32_t &max_block, uint8_t &fragmentation) {
+        native_heap.stats(free_heap, max_block, fragmentation);
+    };
+    return true;
+}();
+
+void *operator new(size_t size) {
+    void *ptr = native_heap.allocate(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+void *operator new[](size_t size) {
+    return operator new(size);
+}
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    return native_heap.allocate(size ? size : 1);
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+    return native_heap.allocate(size ? size : 1);
+}
+void operator delete(void *ptr) noexcept {
+    if (ptr && native_heap.owns(ptr)) native_heap.release(ptr);
+}
+void operator delete[](void *ptr) noexcept {
+    operator delete(ptr);
+}
+void operator delete(void *ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+void operator delete[](void *ptr, size_t) noexcept {
+    operator delete(ptr);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+//One Call API messages for suites running the firmware, with 61 minutes, 48 hours and 8 days
+//of data like the real API sends.
+
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+
+inline void appendf(std::string &text, const char *format, ...) __attribute__((format(printf, 2, 3)));
+inline void appendf(std::string &text, const char *format, ...) {
+    char buf[1024];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    TEST_ASSERT_TRUE(length < (int)sizeof(buf));
+    text += buf;
+}
+
+//One Call message (about 23 kB without alerts), alerts are appended as given
+inline std::string oneCall(uint32_t dt, const char *alerts) {
+    std::string json;
+    appendf(json, "{\"lat\": 50.0880, \"lon\": 14.4208, \"timezone\": \"Europe/Prague\", \"timezone_offset\": 7200, "
+                  "\"current\": {\"dt\": %u, \"sunrise\": %u, \"sunset\": %u, \"temp\": 288.4, \"feels_like\": 287.1, "
+                  "\"pressure\": 1016, \"humidity\": 71, \"dew_point\": 283.1, \"uvi\": 2.35, \"clouds\": 40, \"visibility\": 10000, "
+                  "\"wind_speed\": 3.6, \"wind_deg\": 240, \"weather\": [{\"id\": 802, \"main\": \"Clouds\", "
+                  "\"description\": \"scattered clouds\", \"icon\": \"03d\"}]}, \"minutely\": [", dt, dt - 30000, dt + 10000);
+    for (int i = 0; i < 61; i++) {
+        appendf(json, "%s{\"dt\": %u, \"precipitation\": %d.%02d}", i ? ", " : "", dt + i * 60, i % 3, i * 7 % 100);
+    }
+    json += "], \"hourly\": [";
+    for (int i = 0; i < 48; i++) {
+        appendf(json, "%s{\"dt\": %u, \"temp\": %d.%02d, \"feels_like\": 281.2, \"pressure\": 1015, \"humidity\": 70, "
+                      "\"dew_point\": 281.0, \"uvi\": 1.2, \"clouds\": 50, \"visibility\": 10000, \"wind_speed\": 3.1, "
+                      "\"wind_deg\": 230, \"wind_gust\": 6.2, \"weather\": [{\"id\": 500, \"main\": \"Rain\", "
+                      "\"description\": \"light rain\", \"icon\": \"10d\"}], \"pop\": 0.%02d, \"rain\": {\"1h\": 0.%02d}}",
+                i ? ", " : "", dt + i * 3600, 278 + i % 9, i * 13 % 100, i * 7 % 100, i * 11 % 100);
+    }
+    json += "], \"daily\": [";
+    for (int i = 0; i < 8; i++) {
+        appendf(json, "%s{\"dt\": %u, \"sunrise\": %u, \"sunset\": %u, \"moonrise\": 0, \"moonset\": 0, \"moon_phase\": 0.5, "
+                      "\"temp\": {\"day\": %d.1, \"min\": 280.2, \"max\": 291.3, \"night\": %d.4, \"eve\": 285.5, \"morn\": 281.6}, "
+                      "\"feels_like\": {\"day\": 289.1, \"night\": 281.4, \"eve\": 284.5, \"morn\": 280.6}, \"pressure\": 1014, "
+                      "\"humidity\": 60, \"dew_point\": 280.1, \"wind_speed\": 4.2, \"wind_deg\": 200, \"wind_gust\": 9.1, "
+                      "\"weather\": [{\"id\": 501, \"main\": \"Rain\", \"description\": \"moderate rain\", \"icon\": \"%s\"}], "
+                      "\"clouds\": 75, \"pop\": 0.8, \"rain\": 3.2, \"uvi\": 3.1}",
+                i ? ", " : "", dt + i * 86400, dt + i * 86400 - 30000, dt + i * 86400 + 10000, 286 + i, 279 + i % 3,
+                i % 2 ? "10d" : "04d");
+    }
+    json += "]";
+    if (*alerts) json = json + ", \"alerts\": [" + alerts + "]";
+    json += "}";
+    return json;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+//Host stand-in of PubSubClient with a scripted broker. Messages queued in inbox are delivered by
+//loop() once due on the virtual clock and only for subscribed topics: the payload is written to
+//the stream of setStream() while it is received (as the library does), then the callback gets the
+//payload cut to the buffer size. A subscription queues the retained message of its topic.
+//Publications are recorded in sent. Every loop() charges loop_us (network stack and socket poll).
+
+#include <ESP8266WiFi.h>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+struct MqttMessage {
+    unsigned long due;      //delivery time (virtual ms, inbox) or publication time (sent)
+    std::string topic;
+    std::string payload;
+    bool retained;
+};
+
+class PubSubClient : public Print {
+  public:
+    std::deque<MqttMessage> inbox;          //messages of the broker in delivery order
+    std::vector<MqttMessage> sent;          //publications of the client
+    std::set<std::string> subscriptions;
+    std::map<std::string, MqttMessage> retained;   //retained messages of the broker by topic
+    bool up = true;                         //broker accepts connections
+    bool fail_large = false;                //beginPublish() fails (connection lost while sending)
+    uint32_t loop_us = 150;
+    uint64_t received_us = 0;               //virtual time the last delivered message was received
+
+    PubSubClient(Client &) {}
+
+    PubSubClient &setServer(const char *, uint16_t) { return *this; }
+    PubSubClient &setCallback(void (*callback)(char *, uint8_t *, unsigned int)) { _callback = callback; return *this; }
+    PubSubClient &setStream(Stream &stream) { _stream = &stream; return *this; }
+    bool setBufferSize(uint16_t size) { _buffer_size = size; return true; }
+
+    bool connect(const char *) {
+        _connected = up;
+        return _connected;
+    }
+    void disconnect() {
+        _connected = false;
+        subscriptions.clear();
+    }
+    bool connected() { return _connected; }
+    bool subscribe(const char *topic) {
+        if (!_connected) return false;
+        subscriptions.insert(topic);
+        std::map<std::string, MqttMessage>::iterator message = retained.find(topic);
+        if (message != retained.end()) inbox.push_front({millis(), topic, message->second.payload, true});
+        return true;
+    }
+
+    bool loop() {
+        if (!_connected) return false;
+        delayMicroseconds(loop_us);
+        if (inbox.empty() || inbox.front().due > millis()) return true;
+        MqttMessage message = inbox.front();
+        inbox.pop_front();
+        if (!subscriptions.count(message.topic)) return true;
+
+        if (_stream) _stream->write((const uint8_t *)message.payload.data(), message.payload.size());
+        received_us = micros();
+        std::vector<char> topic(message.topic.begin(), message.topic.end());
+        topic.push_back('\0');
+        std::vector<uint8_t> payload(message.payload.begin(), message.payload.begin() + min(message.payload.size(), (size_t)_buffer_size));
+        if (_callback) _callback(topic.data(), payload.data(), payload.size());
+        return true;
+    }
+
+    bool publish(const char *topic, const char *payload, bool retain = false) {
+        if (!_connected) return false;
+        sent.push_back({millis(), topic, payload, retain});
+        return true;
+    }
+    bool beginPublish(const char *topic, unsigned int, bool retain) {
+        if (!_connected || fail_large) return false;
+        sent.push_back({millis(), topic, "", retain});
+        return true;
+    }
+    using Print::write;
+    size_t write(uint8_t c) override {
+        sent.back().payload += (char)c;
+        return 1;
+    }
+    int endPublish() { return 1; }
+
+  private:
+    void (*_callback)(char *, uint8_t *, unsigned int) = nullptr;
+    Stream *_stream = nullptr;
+    uint16_t _buffer_size = 256;
+    bool _connected = false;
+};
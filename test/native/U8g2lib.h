@@ -0,0 +1,213 @@
+#pragma once
+
+//Host stand-in of U8g2 for native tests and benchmarks.
+//Full frame buffer of a 128x64 display in ST7920 layout rotated by U8G2_R2 (display row y is
+//buffer row 63 - y, pixel x is bit x % 8 of byte 15 - x / 8), so blit.h and the glyph cache
+//work on the real byte layout. Pixel primitives and XBM bitmaps are exact, fonts are not:
+//a glyph is a fixed pattern of its character code in a cell of the font's advance and ascent.
+//Transfers copy the buffer to display memory and charge byte_us per byte to the virtual clock.
+//SSD1306/SH1106 classes transfer vertical tiles (8 consecutive bytes of a tile row), drawing
+//still uses the ST7920 layout.
+
+#include <Arduino.h>
+
+/*----(FONTS)----*/
+//advance, ascent, descent (approximate metrics of the real fonts)
+inline const uint8_t u8g2_font_6x12_te[]                  = {6, 9, (uint8_t)-2};
+inline const uint8_t u8g2_font_profont10_tf[]             = {5, 7, (uint8_t)-2};
+inline const uint8_t u8g2_font_profont11_tf[]             = {6, 8, (uint8_t)-2};
+inline const uint8_t u8g2_font_profont15_tf[]             = {8, 10, (uint8_t)-3};
+inline const uint8_t u8g2_font_profont15_tn[]             = {8, 10, 0};
+inline const uint8_t u8g2_font_profont22_tn[]             = {11, 14, 0};
+inline const uint8_t u8g2_font_open_iconic_www_1x_t[]     = {8, 8, 0};
+inline const uint8_t u8g2_font_open_iconic_weather_1x_t[] = {8, 8, 0};
+
+/*----(TYPES)----*/
+typedef struct {
+    uint8_t *tile_buf_ptr;
+} u8g2_t;
+
+struct u8g2_cb_t {};
+inline const u8g2_cb_t u8g2_cb_r0 = {}, u8g2_cb_r2 = {};
+#define U8G2_R0 (&u8g2_cb_r0)
+#define U8G2_R2 (&u8g2_cb_r2)
+#define U8X8_PIN_NONE 255
+
+/*----(CLASSES)----*/
+class U8G2 {
+  public:
+    static const int width = 128;
+    static const int height = 64;
+
+    uint8_t buffer[width * height / 8] = {};    //frame buffer
+    uint8_t display[width * height / 8] = {};   //display memory (what was sent)
+    unsigned long sent_bytes = 0;               //bytes sent to the display
+    uint32_t byte_us = 0;                       //transfer time per byte
+    uint32_t call_us = 0;                       //drawing time per primitive
+    uint32_t glyph_us = 0;                      //drawing time per glyph
+    uint8_t contrast = 255;
+    bool vertical_tiles = false;                //tile is 8 consecutive bytes (SSD1306, SH1106)
+    void (*on_update)(U8G2 &lcd) = nullptr;     //called after every transfer (tests watching the display)
+
+    U8G2() { _u8g2.tile_buf_ptr = buffer; }
+    U8G2(const U8G2 &) = delete;
+
+    u8g2_t *getU8g2() { return &_u8g2; }
+    bool begin() { return true; }
+    void setPowerSave(uint8_t) {}
+    void setContrast(uint8_t value) { contrast = value; }
+
+    //buffer and transfer
+    uint8_t *getBufferPtr() { return _u8g2.tile_buf_ptr; }
+    uint8_t getBufferTileWidth() { return width / 8; }
+    uint8_t getBufferTileHeight() { return height / 8; }
+    int getDisplayWidth() { return width; }
+    int getDisplayHeight() { return height; }
+    void clearBuffer() { memset(_u8g2.tile_buf_ptr, 0, sizeof(buffer)); }
+    void sendBuffer() { updateDisplayArea(0, 0, width / 8, height / 8); }
+    void updateDisplay() { sendBuffer(); }
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+        for (int row = ty; row < ty + th && vertical_tiles; row++) {
+            memcpy(display + row * width + tx * 8, _u8g2.tile_buf_ptr + row * width + tx * 8, tw * 8);
+        }
+        for (int row = ty * 8; row < (ty + th) * 8 && !vertical_tiles; row++) {
+            memcpy(display + row * width / 8 + tx, _u8g2.tile_buf_ptr + row * width / 8 + tx, tw);
+        }
+        sent_bytes += tw * th * 8;
+        charge(tw * th * 8 * byte_us);
+        if (on_update) on_update(*this);
+    }
+
+    //pixels (color 0 clears, 1 sets, 2 inverts)
+    bool getPixel(int x, int y) {
+        if (x < 0 || x >= width || y < 0 || y >= height) return false;
+        return *pixelByte(x, y) & (1 << (x % 8));
+    }
+    void setDrawColor(uint8_t color) { _color = color; }
+    void setFontMode(uint8_t) {}
+    void setBitmapMode(uint8_t) {}
+    void drawPixel(int x, int y) {
+        if (x < 0 || x >= width || y < 0 || y >= height) return;
+        uint8_t *byte = pixelByte(x, y);
+        uint8_t bit = 1 << (x % 8);
+        if (_color == 0)      *byte &= ~bit;
+        else if (_color == 1) *byte |= bit;
+        else                  *byte ^= bit;
+    }
+    void drawHLine(int x, int y, int w) { for (int i = 0; i < w; i++) drawPixel(x + i, y); charge(call_us); }
+    void drawVLine(int x, int y, int h) { for (int i = 0; i < h; i++) drawPixel(x, y + i); charge(call_us); }
+    void drawBox(int x, int y, int w, int h) {
+        for (int j = 0; j < h; j++) for (int i = 0; i < w; i++) drawPixel(x + i, y + j);
+        charge(call_us);
+    }
+    void drawFrame(int x, int y, int w, int h) {
+        if (w <= 0 || h <= 0) return;
+        drawHLine(x, y, w);
+        drawHLine(x, y + h - 1, w);
+        drawVLine(x, y + 1, h - 2);
+        drawVLine(x + w - 1, y + 1, h - 2);
+    }
+    void drawLine(int x0, int y0, int x1, int y1) {
+        int dx = abs(x1 - x0), dy = -abs(y1 - y0);
+        int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+        for (int err = dx + dy;;) {
+            drawPixel(x0, y0);
+            if (x0 == x1 && y0 == y1) break;
+            int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x0 += sx; }
+            if (e2 <= dx) { err += dx; y0 += sy; }
+        }
+        charge(call_us);
+    }
+    void drawCircle(int x, int y, int r) {
+        for (int j = -r; j <= r; j++) for (int i = -r; i <= r; i++) {
+            int d = i * i + j * j;
+            if (d <= r * r + r && d > (r - 1) * (r - 1) + (r - 1)) drawPixel(x + i, y + j);
+        }
+        charge(call_us);
+    }
+    void drawDisc(int x, int y, int r) {
+        for (int j = -r; j <= r; j++) for (int i = -r; i <= r; i++) {
+            if (i * i + j * j <= r * r + r) drawPixel(x + i, y + j);
+        }
+        charge(call_us);
+    }
+
+    //XBM in solid bitmap mode with draw color 1 (zero bits clear pixels)
+    void drawXBM(int x, int y, int w, int h, const uint8_t *bits) {
+        uint8_t color = _color;
+        int row_bytes = (w + 7) / 8;
+        for (int j = 0; j < h; j++) for (int i = 0; i < w; i++) {
+            _color = (bits[j * row_bytes + i / 8] >> (i % 8)) & 1;
+            drawPixel(x + i, y + j);
+        }
+        _color = color;
+        charge(call_us);
+    }
+    void drawXBMP(int x, int y, int w, int h, const uint8_t *bits) { drawXBM(x, y, w, h, bits); }
+
+    //text
+    void setFont(const uint8_t *font) { _font = font; }
+    int8_t getAscent() { return _font[1]; }
+    int8_t getDescent() { return (int8_t)_font[2]; }
+    int8_t getMaxCharWidth() { return _font[0]; }
+    int8_t getMaxCharHeight() { return _font[1] - (int8_t)_font[2]; }
+    int getStrWidth(const char *text) { return strlen(text) * _font[0]; }
+    int getUTF8Width(const char *text) {
+        int chars = 0;
+        for (; *text; text++) chars += (*text & 0xC0) != 0x80;
+        return chars * _font[0];
+    }
+    int drawGlyph(int x, int y, uint16_t code) {
+        for (int j = 0; j < _font[1] && code != ' '; j++) {
+            for (int i = 0; i < _font[0] - 1; i++) {
+                if (((code * 2654435761u) >> ((i * 3 + j * 5) % 29)) & 1) drawPixel(x + i, y - _font[1] + j);
+            }
+        }
+        charge(glyph_us);
+        return _font[0];
+    }
+    int drawStr(int x, int y, const char *text) {
+        int start = x;
+        for (; *text; text++) x += drawGlyph(x, y, (uint8_t)*text);
+        return x - start;
+    }
+    int drawUTF8(int x, int y, const char *text) {
+        int start = x;
+        while (*text) {
+            uint16_t code = (uint8_t)*text++;
+            if (code >= 0xC0) {
+                code &= (code >= 0xE0) ? 0x0F : 0x1F;
+                while ((*text & 0xC0) == 0x80) code = (code << 6) | (*text++ & 0x3F);
+            }
+            x += drawGlyph(x, y, code);
+        }
+        return x - start;
+    }
+
+  private:
+    u8g2_t _u8g2;
+    uint8_t _color = 1;
+    const uint8_t *_font = u8g2_font_6x12_te;
+
+    uint8_t *pixelByte(int x, int y) {
+        return _u8g2.tile_buf_ptr + (height - 1 - y) * (width / 8) + (width / 8 - 1 - x / 8);
+    }
+    void charge(uint32_t us) {
+        if (us) { nativeClock(); native_time_us += us; }
+    }
+};
+
+//device classes of the display backends (all share the layout above)
+class U8G2_ST7920_128X64_F_HW_SPI : public U8G2 {
+  public:
+    U8G2_ST7920_128X64_F_HW_SPI(const u8g2_cb_t *, uint8_t, uint8_t = U8X8_PIN_NONE) {}
+};
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2 {
+  public:
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C(const u8g2_cb_t *, uint8_t = U8X8_PIN_NONE, uint8_t = U8X8_PIN_NONE, uint8_t = U8X8_PIN_NONE) { vertical_tiles = true; }
+};
+class U8G2_SH1106_128X64_NONAME_F_HW_I2C : public U8G2 {
+  public:
+    U8G2_SH1106_128X64_NONAME_F_HW_I2C(const u8g2_cb_t *, uint8_t = U8X8_PIN_NONE, uint8_t = U8X8_PIN_NONE, uint8_t = U8X8_PIN_NONE) { vertical_tiles = true; }
+};
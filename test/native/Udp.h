@@ -0,0 +1,18 @@
+#pragma once
+
+//Host stand-in of the Arduino UDP interface (tests implement it with scripted servers).
+
+#include <Arduino.h>
+
+class UDP : public Stream {
+  public:
+    virtual uint8_t begin(uint16_t port) = 0;
+    virtual void stop() = 0;
+    virtual int beginPacket(const char *host, uint16_t port) = 0;
+    virtual int endPacket() = 0;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) = 0;
+    virtual int parsePacket() = 0;
+    virtual int read(unsigned char *buffer, size_t len) = 0;
+    using Stream::read;
+};
@@ -0,0 +1,7 @@
+#pragma once
+
+//Host stand-in of the ESP8266 WiFiUDP (talks to the scripted NTP servers of FakeNtp.h).
+
+#include <FakeNtp.h>
+
+class WiFiUDP : public FakeNtpUdp {};
@@ -0,0 +1,87 @@
+#include <unity.h>
+#include "animations.h"
+#include "blit.h"
+#include "weather_icons.h"
+
+//Stepped animations of the weather screen against frames drawn from scratch: the bitmap with
+//the frame's deltas applied, drawn by blitXBM() and clipped at the separator line like main.cpp.
+
+typedef struct {
+    const char *name;
+    const Animation *animation;
+    const uint8_t *bits;
+    int x;
+} Icon;
+
+static const Icon icons[] = {
+    {"few clouds day", &few_clouds_day_animation, few_clouds_day_bits, -8},
+    {"few clouds night", &few_clouds1_night_animation, few_clouds1_night_bits, -8},
+    {"scattered clouds", &scattered_clouds_animation, scattered_clouds_bits, -8},
+    {"broken clouds", &broken_clouds_animation, broken_clouds_bits, -8},
+    {"shower rain", &shower_rain_animation, shower_rain_bits, -8},
+    {"rain day", &rain_day_animation, rain_day_bits, -5},
+    {"rain night", &rain_night_animation, rain_night_bits, -5},
+    {"thunderstorm", &thunderstorm_animation, thunderstorm_bits, -8},
+    {"snow", &snow1_animation, snow1_bits, -8},
+    {"mist", &mist_animation, mist_bits, -8},
+};
+
+static U8G2 lcd;
+static uint8_t expected[sizeof(lcd.buffer)];
+
+//weather screen: icon, separator line at x = 54 and content right of it (drawn over the icon)
+static void drawScreen(const uint8_t *bits, int x) {
+    lcd.clearBuffer();
+    blitXBM<64, 42>(lcd, x, 0, bits);
+    lcd.setDrawColor(0);
+    lcd.drawBox(54, 0, 74, 54);
+    lcd.setDrawColor(1);
+    lcd.drawVLine(54, 0, 54);
+    lcd.drawBox(56, 0, 72, 54);
+}
+
+static void drawFrame(const Icon &icon, uint8_t frame) {
+    uint8_t bits[8 * 42];
+    memcpy(bits, icon.bits, sizeof(bits));
+    const Animation &animation = *icon.animation;
+    for (uint16_t i = animation.starts[frame]; i < animation.starts[frame + 1]; i++) {
+        bits[animation.deltas[i*3] * 8 + animation.deltas[i*3 + 1]] ^= animation.deltas[i*3 + 2];
+    }
+    drawScreen(bits, icon.x);
+}
+
+void setUp() {}
+void tearDown() {
+    animationStart(NULL, 0, 0, 0);
+}
+
+void test_frames_match_redrawn_icon() {
+    for (const Icon &icon : icons) {
+        drawScreen(icon.bits, icon.x);
+        animationStart(icon.animation, icon.x, 0, 54);
+        for (int step = 1; step <= icon.animation->frames * 2; step++) {
+            animationStep(lcd);
+            uint8_t shown[sizeof(lcd.buffer)];
+            memcpy(shown, lcd.buffer, sizeof(shown));
+            drawFrame(icon, step % icon.animation->frames);
+            memcpy(expected, lcd.buffer, sizeof(expected));
+            memcpy(lcd.buffer, shown, sizeof(shown));
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, lcd.buffer, sizeof(expected), icon.name);
+        }
+    }
+}
+
+void test_stopped_animation_does_nothing() {
+    drawScreen(rain_day_bits, -5);
+    memcpy(expected, lcd.buffer, sizeof(expected));
+    TEST_ASSERT_FALSE(animationActive());
+    animationStep(lcd);
+    TEST_ASSERT_EQUAL_MEMORY(expected, lcd.buffer, sizeof(expected));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_frames_match_redrawn_icon);
+    RUN_TEST(test_stopped_animation_does_nothing);
+    return UNITY_END();
+}
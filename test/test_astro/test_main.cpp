@@ -0,0 +1,84 @@
+#include <unity.h>
+#include "astro.h"
+
+//Reference times from the NOAA solar calculator algorithm (upper limb, refraction 0.833°),
+//moons from Meeus (Astronomical Algorithms, chapter 49).
+
+#define PRAGUE 500755, 144378
+#define SYDNEY -338688, 1512093
+#define TROMSO 696492, 189553
+
+void setUp() {}
+void tearDown() {}
+
+void test_sunrise_and_sunset() {
+    //local noon of the day (UTC epoch), offset, location, expected sunrise and sunset
+    const AstroDay &summer = astroDay(1718967600, 7200, PRAGUE);     //2024-06-21
+    TEST_ASSERT_EQUAL(0, summer.polar);
+    TEST_ASSERT_UINT32_WITHIN(60, 1718938357, summer.sunrise);
+    TEST_ASSERT_UINT32_WITHIN(60, 1718997342, summer.sunset);
+
+    const AstroDay &winter = astroDay(1734778800, 3600, PRAGUE);     //2024-12-21
+    TEST_ASSERT_UINT32_WITHIN(60, 1734764323, winter.sunrise);
+    TEST_ASSERT_UINT32_WITHIN(60, 1734793343, winter.sunset);
+
+    const AstroDay &south = astroDay(1709258400, 39600, SYDNEY);     //2024-03-01, daylight saving time
+    TEST_ASSERT_UINT32_WITHIN(60, 1709235782, south.sunrise);
+    TEST_ASSERT_UINT32_WITHIN(60, 1709281880, south.sunset);
+}
+
+void test_polar_day_and_night() {
+    const AstroDay &summer = astroDay(1718967600, 7200, TROMSO);
+    TEST_ASSERT_EQUAL(1, summer.polar);
+    TEST_ASSERT_EQUAL(0, summer.sunrise);
+    TEST_ASSERT_TRUE(astroIsDay(summer, 1718967600 + 43200));   //midnight sun
+
+    const AstroDay &winter = astroDay(1734778800, 3600, TROMSO);
+    TEST_ASSERT_EQUAL(-1, winter.polar);
+    TEST_ASSERT_FALSE(astroIsDay(winter, 1734778800));          //polar night at noon
+}
+
+void test_is_day() {
+    const AstroDay &day = astroDay(1718967600, 7200, PRAGUE);
+    TEST_ASSERT_FALSE(astroIsDay(day, day.sunrise - 1));
+    TEST_ASSERT_TRUE(astroIsDay(day, day.sunrise));
+    TEST_ASSERT_TRUE(astroIsDay(day, day.sunset - 1));
+    TEST_ASSERT_FALSE(astroIsDay(day, day.sunset));
+}
+
+void test_local_day_and_cache() {
+    //23:30 local time is still the same local day (UTC is the next day)
+    const AstroDay &evening = astroDay(1718967600 + 37800, 7200, PRAGUE);
+    TEST_ASSERT_UINT32_WITHIN(60, 1718938357, evening.sunrise);
+    long day = evening.day;
+    TEST_ASSERT_EQUAL(day, astroDay(1718967600 - 36000, 7200, PRAGUE).day);
+    TEST_ASSERT_EQUAL(day + 1, astroDay(1718967600 + 43200, 7200, PRAGUE).day);
+
+    //another location on the same day is recomputed
+    uint32_t prague = astroDay(1718967600, 7200, PRAGUE).sunrise;
+    TEST_ASSERT_TRUE(astroDay(1718967600, 7200, 500755, 164378).sunrise < prague);  //2° east rises earlier
+}
+
+void test_moon_phase() {
+    const AstroDay &new_moon = astroDay(1712600479, 0, PRAGUE);     //2024-04-08 18:21 UTC
+    TEST_ASSERT_EQUAL(0, new_moon.moon_phase);
+    TEST_ASSERT_TRUE(new_moon.moon_light <= 2);
+
+    const AstroDay &full_moon = astroDay(1713916046, 0, PRAGUE);    //2024-04-23 23:47 UTC
+    TEST_ASSERT_EQUAL(4, full_moon.moon_phase);
+    TEST_ASSERT_TRUE(full_moon.moon_light >= 98);
+
+    const AstroDay &quarter = astroDay(1712600479 + 7 * 86400 + 43200, 0, PRAGUE);
+    TEST_ASSERT_EQUAL(2, quarter.moon_phase);
+    TEST_ASSERT_INT_WITHIN(10, 50, quarter.moon_light);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sunrise_and_sunset);
+    RUN_TEST(test_polar_day_and_night);
+    RUN_TEST(test_is_day);
+    RUN_TEST(test_local_day_and_cache);
+    RUN_TEST(test_moon_phase);
+    return UNITY_END();
+}
@@ -0,0 +1,123 @@
+#include <unity.h>
+#include <string>
+#include <vector>
+#include <OneCall.h>
+#include "main.cpp"
+
+//Latency of a new weather alert: the firmware (main.cpp) runs against the stand-ins with the
+//host CPU time charged x40 to the virtual clock (ESP8266 at 80 MHz) and the ST7920 transfer at
+//23 us per byte. Alerts arrive at random times in One Call messages of about 25 kB for one of
+//two cities, latency is measured from the last byte of the message to the alert frame complete
+//on the display (rows above the footer). Host scheduling hiccups are scaled as well, so the
+//maximum varies between runs.
+
+#define CPU_SCALE 40
+#define TRIALS 200
+
+static bool booted = false;
+static uint64_t armed_us = 0;   //alert message queued (later receipt is the one measured)
+static uint64_t shown_us = 0;   //alert frame complete on the display
+
+//Czech alert with a description longer than the stored part
+static std::string alertMessage(uint32_t dt, uint32_t start) {
+    std::string alert;
+    appendf(alert, "{\"sender_name\": \"Czech Hydrometeorological Institute\", \"event\": \"Siln\\u00e9 bou\\u0159ky\", "
+                   "\"start\": %u, \"end\": %u, \"description\": \"", start, dt + 6 * 3600);
+    for (int i = 0; i < 6; i++) {
+        alert += "O\\u010dek\\u00e1vaj\\u00ed se siln\\u00e9 bou\\u0159ky s p\\u0159\\u00edvalov\\u00fdmi sr\\u00e1\\u017ekami "
+                 "kolem 30 mm, krupobit\\u00edm a n\\u00e1razy v\\u011btru kolem 25 m/s. ";
+    }
+    alert += "\", \"tags\": [\"Thunderstorm\"]}";
+    return oneCall(dt, alert.c_str());
+}
+
+//transfer hook: alert screen drawn after the message and its frame sent completely
+static void watchDisplay(U8G2 &lcd) {
+    const int screen_bytes = (LCD_HEIGHT - 54) * LCD_WIDTH / 8;  //buffer starts with the footer (rotated)
+    if (armed_us && client.received_us > armed_us && !shown_us && screen == ALERT_SCREEN && !renderPending()
+        && !memcmp(lcd.display + screen_bytes, lcd.buffer + screen_bytes, sizeof(lcd.buffer) - screen_bytes)) {
+        shown_us = micros();
+    }
+}
+
+static void runUntil(unsigned long ms) {
+    while ((long)(millis() - ms) < 0) loop();
+}
+
+static uint32_t utcNow() {
+    return time_client.getEpochTime() - time_offset;
+}
+
+static void boot() {
+    native_ntp_epoch_ms = 1792400000000ULL;
+    native_cpu_scale = CPU_SCALE;
+    u8g2.byte_us = 23;
+    u8g2.on_update = watchDisplay;
+    srand(7);
+    setup();
+    config.city_count = 2;              //stored by an earlier configuration message, then reboot
+    strcpy(config.cities[0], "Prague");
+    strcpy(config.cities[1], "Brno");
+    configWrite(config);
+    setup();
+
+    //retained weather of both cities right after connecting
+    client.inbox.push_back({millis() + 500, "weather/Prague", oneCall(utcNow(), ""), true});
+    client.inbox.push_back({millis() + 600, "weather/Brno", oneCall(utcNow(), ""), true});
+    runUntil(millis() + 10000);
+    booted = true;
+}
+
+void setUp() {
+    if (!booted) boot();
+}
+void tearDown() {}
+
+static void latency(bool power_save) {
+    config.power_save = power_save;
+    powerMode(power_save);
+
+    std::vector<double> latency_ms;
+    double sum = 0;
+    for (int trial = 0; trial < TRIALS; trial++) {
+        runUntil(millis() + 3000 + random(20000));
+        int index = trial % 2;
+        std::string topic = std::string("weather/") + config.cities[index];
+        client.inbox.push_back({millis(), topic, alertMessage(utcNow(), 1792400000 + trial * 3600), false});
+        armed_us = micros();
+        shown_us = 0;
+        unsigned long deadline = millis() + 5000;
+        while (!shown_us && (long)(millis() - deadline) < 0) loop();
+        TEST_ASSERT_TRUE_MESSAGE(shown_us, "alert not shown");
+        TEST_ASSERT_EQUAL(index, city);
+        latency_ms.push_back((shown_us - client.received_us) / 1000.0);
+        sum += latency_ms.back();
+    }
+    armed_us = 0;
+
+    std::sort(latency_ms.begin(), latency_ms.end());
+    printf("  power_save %d: %d alerts, latency ms median %.1f, mean %.1f, p95 %.1f, max %.1f\n", power_save, TRIALS,
+           latency_ms[TRIALS / 2], sum / TRIALS, latency_ms[TRIALS * 95 / 100], latency_ms.back());
+}
+
+void test_weather_received() {
+    TEST_ASSERT_TRUE(weather[0].dt);
+    TEST_ASSERT_TRUE(weather[1].dt);
+    TEST_ASSERT_FALSE(weatherStale(0));
+}
+
+void test_alert_latency() {
+    latency(false);
+}
+
+void test_alert_latency_power_save() {
+    latency(true);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_weather_received);
+    RUN_TEST(test_alert_latency);
+    RUN_TEST(test_alert_latency_power_save);
+    return UNITY_END();
+}
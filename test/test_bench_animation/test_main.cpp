@@ -0,0 +1,66 @@
+#include <unity.h>
+#include <chrono>
+#include "animations.h"
+#include "blit.h"
+#include "weather_icons.h"
+
+//Cost of an animation frame of the weather screen: stepping time (host) and tile rows changed
+//per frame, which the flush sends (ST7920: 128 bytes per row at 23 us per byte).
+
+typedef struct {
+    const char *name;
+    const Animation *animation;
+    const uint8_t *bits;
+    int x;
+} Icon;
+
+static const Icon icons[] = {
+    {"few clouds day", &few_clouds_day_animation, few_clouds_day_bits, -8},
+    {"few clouds night", &few_clouds1_night_animation, few_clouds1_night_bits, -8},
+    {"scattered clouds", &scattered_clouds_animation, scattered_clouds_bits, -8},
+    {"broken clouds", &broken_clouds_animation, broken_clouds_bits, -8},
+    {"shower rain", &shower_rain_animation, shower_rain_bits, -8},
+    {"rain day", &rain_day_animation, rain_day_bits, -5},
+    {"rain night", &rain_night_animation, rain_night_bits, -5},
+    {"thunderstorm", &thunderstorm_animation, thunderstorm_bits, -8},
+    {"snow", &snow1_animation, snow1_bits, -8},
+    {"mist", &mist_animation, mist_bits, -8},
+};
+
+static U8G2 lcd;
+
+void setUp() {}
+void tearDown() {}
+
+void test_frame_cost() {
+    for (const Icon &icon : icons) {
+        lcd.clearBuffer();
+        blitXBM<64, 42>(lcd, icon.x, 0, icon.bits);
+        animationStart(icon.animation, icon.x, 0, 54);
+
+        //changed rows over a whole cycle
+        int frames = icon.animation->frames, rows = 0;
+        for (int frame = 0; frame < frames; frame++) {
+            uint8_t before[sizeof(lcd.buffer)];
+            memcpy(before, lcd.buffer, sizeof(before));
+            animationStep(lcd);
+            for (int row = 0; row < 8; row++) rows += memcmp(before + row * 128, lcd.buffer + row * 128, 128) != 0;
+        }
+
+        const int steps = 100000;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int i = 0; i < steps; i++) animationStep(lcd);
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / steps;
+
+        double per_frame = (double)rows / frames;
+        printf("  %-16s %d frames, step %4.0f ns (host), %.2f rows/frame, %4.1f ms transfer\n",
+               icon.name, frames, ns, per_frame, per_frame * 128 * 23 / 1000);
+    }
+    animationStart(NULL, 0, 0, 0);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_frame_cost);
+    return UNITY_END();
+}
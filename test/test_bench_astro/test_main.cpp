@@ -0,0 +1,132 @@
+#include <unity.h>
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <random>
+#include <vector>
+#include "astro.h"
+
+//Accuracy of the fixed point astro module against double precision references on the host:
+//sunrise and sunset by the NOAA solar calculator algorithm (iterated at the event time),
+//true new and full moons by Meeus (Astronomical Algorithms, chapter 49), days of 2000-2040.
+
+static double rad(double deg) { return deg * M_PI / 180; }
+static double deg(double rad) { return rad * 180 / M_PI; }
+
+//solar declination and equation of time (minutes) at julian day
+static void noaa(double jd, double &declination, double &equation) {
+    double t = (jd - 2451545) / 36525;
+    double l0 = fmod(280.46646 + t * (36000.76983 + t * 0.0003032), 360);
+    double m = 357.52911 + t * (35999.05029 - 0.0001537 * t);
+    double e = 0.016708634 - t * (0.000042037 + 0.0000001267 * t);
+    double c = sin(rad(m)) * (1.914602 - t * (0.004817 + 0.000014 * t)) + sin(rad(2 * m)) * (0.019993 - 0.000101 * t) + sin(rad(3 * m)) * 0.000289;
+    double omega = 125.04 - 1934.136 * t;
+    double lambda = l0 + c - 0.00569 - 0.00478 * sin(rad(omega));
+    double epsilon = 23 + (26 + (21.448 - t * (46.815 + t * (0.00059 - t * 0.001813))) / 60) / 60 + 0.00256 * cos(rad(omega));
+    declination = deg(asin(sin(rad(epsilon)) * sin(rad(lambda))));
+    double y = pow(tan(rad(epsilon / 2)), 2);
+    equation = 4 * deg(y * sin(2 * rad(l0)) - 2 * e * sin(rad(m)) + 4 * e * y * sin(rad(m)) * cos(2 * rad(l0))
+                       - 0.5 * y * y * sin(4 * rad(l0)) - 1.25 * e * e * sin(2 * rad(m)));
+}
+
+//sunrise (sign -1) or sunset (1) of the day of noon (UTC epoch), false when the sun does not rise or set
+static bool sunEvent(double noon, double latitude, double longitude, int sign, double &event) {
+    double t = noon, day = floor(noon / 86400) * 86400;
+    for (int i = 0; i < 5; i++) {
+        double declination, equation;
+        noaa(t / 86400 + 2440587.5, declination, equation);
+        double c = (cos(rad(90.833)) - sin(rad(latitude)) * sin(rad(declination))) / (cos(rad(latitude)) * cos(rad(declination)));
+        if (fabs(c) > 1) return false;
+        t = day + (720 - 4 * longitude - equation + sign * 4 * deg(acos(c))) * 60;
+    }
+    event = t;
+    return true;
+}
+
+//new moon (k whole) or full moon (k + 0.5) as UTC epoch
+static double meeusMoon(double k) {
+    double t = k / 1236.85;
+    double jde = 2451550.09766 + 29.530588861 * k + 0.00015437 * t * t;
+    double e = 1 - 0.002516 * t;
+    double m = rad(2.5534 + 29.10535670 * k), mp = rad(201.5643 + 385.81693528 * k);
+    double f = rad(160.7108 + 390.67050284 * k), omega = rad(124.7746 - 1.56375588 * k);
+    bool full = k != floor(k);
+    double c = (full ? -0.40614 : -0.40720) * sin(mp) + (full ? 0.17302 : 0.17241) * e * sin(m) + (full ? 0.01614 : 0.01608) * sin(2 * mp)
+             + (full ? 0.01043 : 0.01039) * sin(2 * f) + (full ? 0.00734 : 0.00739) * e * sin(mp - m) - (full ? 0.00515 : 0.00514) * e * sin(mp + m)
+             + (full ? 0.00209 : 0.00208) * e * e * sin(2 * m) - 0.00017 * sin(omega);
+    return (jde + c - 2440587.5) * 86400 - 64;     //TT to UT (approximately)
+}
+
+typedef struct {
+    const char *name;
+    double latitude, longitude;
+    long offset;
+} City;
+
+static const City cities[] = {
+    {"Prague", 50.0755, 14.4378, 3600}, {"Sydney", -33.8688, 151.2093, 36000}, {"New York", 40.7128, -74.006, -18000},
+    {"Quito", -0.18, -78.47, -18000}, {"Reykjavik", 64.1466, -21.9426, 0}, {"Tromso", 69.6496, 18.956, 3600},
+    {"Tokyo", 35.68, 139.69, 32400}, {"Ushuaia", -54.8, -68.3, -10800},
+};
+
+void setUp() {}
+void tearDown() {}
+
+//days when the reference has only one of the events (sun sets or rises just across local
+//midnight at the start or end of polar day/night) are counted apart, they are not mismatches
+void test_sun_accuracy() {
+    std::mt19937 rng(1);
+    int polar_mismatches = 0;
+    for (const City &city : cities) {
+        std::vector<long> errors;
+        int polar = 0, transition = 0;
+        for (int i = 0; i < 250; i++) {
+            long day = 10957 + rng() % (365 * 40);
+            double noon = day * 86400.0 + 43200 - city.offset;
+            double rise, set;
+            bool has_rise = sunEvent(noon, city.latitude, city.longitude, -1, rise);
+            bool has_set = sunEvent(noon, city.latitude, city.longitude, 1, set);
+            const AstroDay &astro = astroDay(noon, city.offset, lround(city.latitude * 1e4), lround(city.longitude * 1e4));
+            if (has_rise != has_set) transition++;
+            else if (!has_rise || astro.polar) {
+                polar++;
+                polar_mismatches += has_rise == (astro.polar != 0);
+            }
+            else errors.push_back(std::max(labs(astro.sunrise - lround(rise)), labs(astro.sunset - lround(set))));
+        }
+        std::sort(errors.begin(), errors.end());
+        printf("  %-10s %3zu days: max %3ld s, 95%% %3ld s, %d polar, %d transition\n", city.name, errors.size(), errors.back(),
+               errors[errors.size() * 95 / 100], polar, transition);
+    }
+    printf("  polar day/night mismatches: %d\n", polar_mismatches);
+    TEST_ASSERT_EQUAL(0, polar_mismatches);
+}
+
+void test_moon_phase_accuracy() {
+    int exact = 0, off_by_one = 0, worse = 0;
+    for (int k2 = 0; k2 < 2 * 495; k2++) {
+        const AstroDay &astro = astroDay(lround(meeusMoon(k2 / 2.0)), 0, 0, 0);
+        int difference = ((astro.moon_phase - (k2 % 2 ? 4 : 0)) + 12) % 8 - 4;
+        if (!difference) exact++;
+        else if (abs(difference) == 1) off_by_one++;
+        else worse++;
+    }
+    printf("  moon phase on the day of %d true new/full moons: %d exact, %d off by one, %d worse\n", 2 * 495, exact, off_by_one, worse);
+    TEST_ASSERT_EQUAL(0, worse);
+}
+
+void test_cost() {
+    volatile uint32_t sink = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100000; i++) sink += astroDay(1700000000u + i * 86400u, 3600, 500755 + (i & 1), 144378).sunrise;
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / 100000;
+    printf("  %.0f ns per day (host)\n", ns);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sun_accuracy);
+    RUN_TEST(test_moon_phase_accuracy);
+    RUN_TEST(test_cost);
+    return UNITY_END();
+}
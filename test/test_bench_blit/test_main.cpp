@@ -0,0 +1,44 @@
+#include <unity.h>
+#include <chrono>
+#include "blit.h"
+
+//Drawing cost of the icon sizes: blitXBM() against per pixel drawXBM() of the U8g2 stand-in
+//(host, u8g2 itself decodes XBM pixel by pixel as well). Positions sweep 40 x offsets like the
+//forecast scrolling, so unaligned and clipped rows are included.
+
+static U8G2 lcd;
+
+template <uint8_t W, uint8_t H>
+static void bench() {
+    static uint8_t bits[(W + 7) / 8 * H];
+    for (size_t i = 0; i < sizeof(bits); i++) bits[i] = i * 37;
+    const int rounds = 20000;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) lcd.drawXBM(i % 40 - 8, 0, W, H, bits);
+    double u8g2 = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) blitXBM<W, H>(lcd, i % 40 - 8, 0, bits);
+    double blit = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+    printf("  %2dx%-2d drawXBM %7.0f ns, blitXBM %5.0f ns (host)\n", W, H, u8g2, blit);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_blit_cost() {
+    bench<64, 42>();
+    bench<43, 54>();
+    bench<40, 30>();
+    bench<15, 7>();
+    bench<11, 12>();
+    bench<6, 6>();
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_blit_cost);
+    return UNITY_END();
+}
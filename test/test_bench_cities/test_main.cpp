@@ -0,0 +1,84 @@
+#include <unity.h>
+#include <chrono>
+#include <OneCall.h>
+#include "main.cpp"
+
+//Cost of the configured number of cities, 1 against 8: RAM of the weather records allocated at
+//boot, host CPU time of receiving a One Call message of about 23 kB (streaming parse, topic
+//dispatch, storing the record) and of a minute of the firmware loop (screens rotating through
+//the cities). The firmware runs on the stand-ins with the cities stored by an earlier
+//configuration message and the station rebooted.
+
+#define MESSAGES 200
+
+static const char *const names[] = {"Prague", "Brno", "Ostrava", "Plzen", "Liberec", "Olomouc", "Zlin", "Pardubice"};
+
+static uint32_t utcNow() {
+    return time_client.getEpochTime() - time_offset;
+}
+
+static void runFor(unsigned long ms) {
+    unsigned long end = millis() + ms;
+    while ((long)(millis() - end) < 0) loop();
+}
+
+static double hostUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void boot(uint8_t count) {
+    client.disconnect();
+    setup();
+    config.city_count = count;
+    for (uint8_t i = 0; i < count; i++) strcpy(config.cities[i], names[i]);
+    configWrite(config);
+    setup();
+    TEST_ASSERT_EQUAL(count, weather_slots);
+
+    for (uint8_t i = 0; i < count; i++) {
+        client.retained[std::string("weather/") + names[i]] = {0, std::string("weather/") + names[i], oneCall(utcNow(), ""), true};
+    }
+    runFor(10000);
+    for (uint8_t i = 0; i < count; i++) TEST_ASSERT_TRUE_MESSAGE(weather[i].dt, names[i]);
+}
+
+static void bench(uint8_t count) {
+    boot(count);
+
+    //messages for every city in turn, timed from queueing to the record stored
+    double receive_us = 0;
+    for (int i = 0; i < MESSAGES; i++) {
+        uint8_t index = i % count;
+        uint32_t dt = utcNow() + i + 1;
+        client.inbox.push_back({millis(), std::string("weather/") + names[index], oneCall(dt, ""), false});
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        while (weather[index].dt != dt) client.loop();
+        receive_us += hostUs(start);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    runFor(60000);
+    double loop_us = hostUs(start);
+
+    printf("  %d cities: weather %u B (%u B a city), receive %.0f us a message, loop %.1f ms a minute (host)\n", count,
+           (unsigned)(weather_slots * (sizeof(CityWeather) + sizeof(WeatherRequest))),
+           (unsigned)(sizeof(CityWeather) + sizeof(WeatherRequest)), receive_us / MESSAGES, loop_us / 1000);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_one_city() {
+    bench(1);
+}
+
+void test_eight_cities() {
+    bench(8);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_one_city);
+    RUN_TEST(test_eight_cities);
+    return UNITY_END();
+}
@@ -0,0 +1,251 @@
+#include <unity.h>
+#include <chrono>
+#include <vector>
+#include <OneCall.h>
+#include "main.cpp"
+
+//Day of weather updates every 10 minutes sent as full One Call messages against deltas of the
+//changed values. No recording of a publisher is available, so the day is simulated: current
+//values change every update, minutely precipitation during two showers, the hourly forecast
+//shifts on every hour and the daily one at midnight. The publisher diffs all values the station
+//uses (61 minutes, 48 hours and 8 days like the API sends them) and answers full requests of
+//the station with a full message. Messages go through the PubSubClient stand-in into main.cpp,
+//after every update the station's record has to match the full message parsed on its own.
+
+#define UPDATES 144
+#define UPDATE_S 600
+
+static const char *topic = "weather/Random City";
+static const char *delta_topic = "weather/Random City/delta";
+static const char *request_topic = "weather/requests/Random City";
+
+typedef struct {
+    uint8_t field;
+    int index;
+    std::string value;
+} Value;
+
+static uint32_t day_start;
+
+static uint32_t utcNow() {
+    return time_client.getEpochTime() - time_offset;
+}
+
+static double hostUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+//fixed point number in One Call text (value in hundredths)
+static std::string centi(int value) {
+    char text[16];
+    snprintf(text, sizeof(text), "%d.%02d", value / 100, value % 100);
+    return text;
+}
+
+static std::string number(long value) {
+    return std::to_string(value);
+}
+
+//precipitation of absolute minute (showers 7:10-7:40 and 14:00-16:30, mm/h in hundredths)
+static int minuteRain(uint32_t minute) {
+    uint32_t of_day = minute % 1440;
+    bool shower = (of_day >= 430 && of_day < 460) || (of_day >= 840 && of_day < 990);
+    return shower ? 10 + minute * 37 % 180 : 0;
+}
+
+static bool rainyHour(uint32_t hour) {
+    return hour % 24 == 7 || (hour % 24 >= 14 && hour % 24 <= 16);
+}
+
+//values the station uses at time t, in the order of the full message
+static std::vector<Value> values(uint32_t t) {
+    int k = (t - day_start) / UPDATE_S;
+    uint32_t hour = t / 3600, day = t / 86400, minute = t / 60;
+    int of_day = t % 86400 / 3600;
+    bool daylight = of_day >= 6 && of_day < 20;
+    std::vector<Value> list = {
+        {FIELD_DT, 0, number(t)},
+        {FIELD_TEMP, 0, centi(28150 + of_day * 40 + k * 29 % 300)},
+        {FIELD_HUMIDITY, 0, number(60 + k / 6 % 20)},
+        {FIELD_PRESSURE, 0, number(1012 + k / 36)},
+        {FIELD_WIND_SPEED, 0, centi((20 + k * 7 % 25) * 10)},
+        {FIELD_UVI, 0, centi(daylight ? k * 11 % 500 : 0)},
+        {FIELD_ICON, 0, rainyHour(hour) ? "10d" : !daylight ? "01n" : k / 9 % 2 ? "03d" : "04d"},
+    };
+    for (int i = 0; i < 61; i++) list.push_back({FIELD_MINUTE_RAIN, i, centi(minuteRain(minute + i))});
+    for (int i = 0; i < 48; i++) {
+        uint32_t h = hour + i;
+        list.push_back({FIELD_HOUR_TEMP, i, centi(28150 + h * 53 % 900)});
+        list.push_back({FIELD_HOUR_POP, i, centi(rainyHour(h) ? 80 + h % 20 : h * 7 % 30)});
+        list.push_back({FIELD_HOUR_RAIN, i, centi(rainyHour(h) ? 50 + h * 31 % 200 : 0)});
+    }
+    for (int i = 0; i < 8; i++) {
+        uint32_t d = day + i;
+        list.push_back({FIELD_DAY_DT, i, number(d * 86400 + 10 * 3600)});
+        list.push_back({FIELD_DAY_TEMP, i, centi(29000 + d * 71 % 600)});
+        list.push_back({FIELD_NIGHT_TEMP, i, centi(27900 + d * 43 % 400)});
+        list.push_back({FIELD_DAY_UVI, i, centi(200 + d * 13 % 300)});
+        list.push_back({FIELD_DAY_ICON, i, d % 3 ? "10d" : "04d"});
+    }
+    return list;
+}
+
+//value of field at index in the list
+static const char *find(const std::vector<Value> &list, uint8_t field, int index) {
+    for (const Value &value : list) {
+        if (value.field == field && value.index == index) return value.value.c_str();
+    }
+    return "0";
+}
+
+//full One Call message with the values and the fields the station skips
+static std::string full(uint32_t t, uint32_t version) {
+    std::vector<Value> list = values(t);
+    std::string json;
+    appendf(json, "{\"version\": %u, \"lat\": 50.0880, \"lon\": 14.4208, \"timezone\": \"Europe/Prague\", "
+                  "\"timezone_offset\": 7200, \"current\": {\"dt\": %u, \"sunrise\": %u, \"sunset\": %u, \"temp\": %s, "
+                  "\"feels_like\": 287.1, \"pressure\": %s, \"humidity\": %s, \"dew_point\": 283.1, \"uvi\": %s, "
+                  "\"clouds\": 40, \"visibility\": 10000, \"wind_speed\": %s, \"wind_deg\": 240, \"weather\": [{\"id\": 802, "
+                  "\"main\": \"Clouds\", \"description\": \"scattered clouds\", \"icon\": \"%s\"}]}, \"minutely\": [",
+            version, t, day_start + 5 * 3600, day_start + 20 * 3600, find(list, FIELD_TEMP, 0),
+            find(list, FIELD_PRESSURE, 0), find(list, FIELD_HUMIDITY, 0), find(list, FIELD_UVI, 0),
+            find(list, FIELD_WIND_SPEED, 0), find(list, FIELD_ICON, 0));
+    for (int i = 0; i < 61; i++) {
+        appendf(json, "%s{\"dt\": %u, \"precipitation\": %s}", i ? ", " : "", t / 60 * 60 + i * 60,
+                find(list, FIELD_MINUTE_RAIN, i));
+    }
+    json += "], \"hourly\": [";
+    for (int i = 0; i < 48; i++) {
+        const char *rain = find(list, FIELD_HOUR_RAIN, i);
+        appendf(json, "%s{\"dt\": %u, \"temp\": %s, \"feels_like\": 281.2, \"pressure\": 1015, \"humidity\": 70, "
+                      "\"dew_point\": 281.0, \"uvi\": 1.2, \"clouds\": 50, \"visibility\": 10000, \"wind_speed\": 3.1, "
+                      "\"wind_deg\": 230, \"wind_gust\": 6.2, \"weather\": [{\"id\": 500, \"main\": \"Rain\", "
+                      "\"description\": \"light rain\", \"icon\": \"10d\"}], \"pop\": %s",
+                i ? ", " : "", t / 3600 * 3600 + i * 3600, find(list, FIELD_HOUR_TEMP, i), find(list, FIELD_HOUR_POP, i));
+        if (strcmp(rain, "0.00")) appendf(json, ", \"rain\": {\"1h\": %s}", rain);     //API leaves out dry hours
+        json += "}";
+    }
+    json += "], \"daily\": [";
+    for (int i = 0; i < 8; i++) {
+        appendf(json, "%s{\"dt\": %s, \"sunrise\": 0, \"sunset\": 0, \"moonrise\": 0, \"moonset\": 0, \"moon_phase\": 0.5, "
+                      "\"temp\": {\"day\": %s, \"min\": 280.2, \"max\": 291.3, \"night\": %s, \"eve\": 285.5, \"morn\": 281.6}, "
+                      "\"feels_like\": {\"day\": 289.1, \"night\": 281.4, \"eve\": 284.5, \"morn\": 280.6}, \"pressure\": 1014, "
+                      "\"humidity\": 60, \"dew_point\": 280.1, \"wind_speed\": 4.2, \"wind_deg\": 200, \"wind_gust\": 9.1, "
+                      "\"weather\": [{\"id\": 501, \"main\": \"Rain\", \"description\": \"moderate rain\", \"icon\": \"%s\"}], "
+                      "\"clouds\": 75, \"pop\": 0.8, \"rain\": 3.2, \"uvi\": %s}",
+                i ? ", " : "", find(list, FIELD_DAY_DT, i), find(list, FIELD_DAY_TEMP, i), find(list, FIELD_NIGHT_TEMP, i),
+                find(list, FIELD_DAY_ICON, i), find(list, FIELD_DAY_UVI, i));
+    }
+    json += "]}";
+    return json;
+}
+
+//delta of the values changed from time before to time t, number of values in count
+static std::string delta(uint32_t before, uint32_t t, uint32_t version, int &count) {
+    std::vector<Value> old_list = values(before), list = values(t);
+    std::string json;
+    appendf(json, "{\"base\":%u,\"version\":%u,\"d\":[", version - 1, version);
+    count = 0;
+    for (size_t i = 0; i < list.size(); i++) {
+        if (list[i].value == old_list[i].value) continue;
+        bool text = list[i].field == FIELD_ICON || list[i].field == FIELD_DAY_ICON;
+        appendf(json, "%s%d,%d,%s%s%s", count++ ? "," : "", list[i].field, list[i].index, text ? "\"" : "",
+                list[i].value.c_str(), text ? "\"" : "");
+    }
+    json += "]}";
+    return json;
+}
+
+//record the station has to hold after the update (full message parsed on its own)
+static void expectRecord(const std::string &message) {
+    static CityWeather expected;
+    expected = CityWeather();
+    JsonStream json(onWeatherValue, &expected);
+    for (char c : message) json.feed(c);
+    TEST_ASSERT_TRUE(json.done());
+
+    const CityWeather &data = weather[0];
+    TEST_ASSERT_EQUAL(expected.dt, data.dt);
+    TEST_ASSERT_EQUAL(0, memcmp(&expected.current, &data.current, sizeof(data.current)));
+    TEST_ASSERT_EQUAL(0, memcmp(expected.daily, data.daily, sizeof(data.daily)));
+    TEST_ASSERT_EQUAL(0, memcmp(expected.hourly_temp, data.hourly_temp, sizeof(data.hourly_temp)));
+    TEST_ASSERT_EQUAL(0, memcmp(expected.hourly_pop, data.hourly_pop, sizeof(data.hourly_pop)));
+    TEST_ASSERT_EQUAL(0, memcmp(expected.hourly_rain, data.hourly_rain, sizeof(data.hourly_rain)));
+    TEST_ASSERT_EQUAL(0, memcmp(expected.minutely, data.minutely, sizeof(data.minutely)));
+}
+
+//deliver message and wait until the station stored the version or sent a request
+static double deliver(const char *to, const std::string &payload, uint32_t version) {
+    client.sent.clear();
+    client.inbox.push_back({millis(), to, payload, false});
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    while (!client.inbox.empty()) client.loop();
+    double us = hostUs(start);
+    loop();
+    TEST_ASSERT_TRUE(weather[0].version == version || weather[0].version == version - 1);
+    return us;
+}
+
+static bool requested() {
+    unsigned long end = millis() + WEATHER_JITTER + SECOND;
+    while ((long)(millis() - end) < 0) {
+        loop();
+        for (const MqttMessage &message : client.sent) {
+            if (message.topic == request_topic) return true;
+        }
+    }
+    return false;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_simulated_day() {
+    setup();
+    day_start = (utcNow() / 86400 + 1) * 86400;
+    uint32_t version = 1;
+    client.retained[topic] = {0, topic, full(day_start, version), true};
+    unsigned long end = millis() + 10000;
+    while ((long)(millis() - end) < 0) loop();
+    TEST_ASSERT_EQUAL(version, weather[0].version);
+
+    unsigned long full_bytes = 0, delta_bytes = 0, answer_bytes = 0, request_bytes = 0;
+    unsigned long full_messages = 0, values_sent = 0, deltas = 0, requests = 0;
+    double full_us = 0, delta_us = 0;
+    for (int k = 1; k <= UPDATES; k++) {
+        uint32_t t = day_start + k * UPDATE_S;
+        std::string snapshot = full(t, ++version);
+        full_bytes += snapshot.size();
+
+        int count;
+        std::string patch = delta(t - UPDATE_S, t, version, count);
+        delta_bytes += patch.size();
+        values_sent += count;
+        delta_us += deliver(delta_topic, patch, version);
+        deltas++;
+        if (weather[0].version != version) {
+            TEST_ASSERT_TRUE_MESSAGE(requested(), "no full request after rejected delta");
+            request_bytes += client.sent.back().payload.size();
+            answer_bytes += snapshot.size();
+            requests++;
+            full_us += deliver(topic, snapshot, version);
+            full_messages++;
+        }
+        TEST_ASSERT_EQUAL(version, weather[0].version);
+        expectRecord(snapshot);
+        TEST_ASSERT_FALSE(requested());
+    }
+
+    printf("  full messages: %lu kB a day (%lu B a message)\n", full_bytes / 1000, full_bytes / UPDATES);
+    printf("  deltas: %lu kB a day (%lu values a delta) and %lu kB of %lu full answers to %lu requests (%lu B)\n",
+           delta_bytes / 1000, values_sent / deltas, answer_bytes / 1000, full_messages, requests, request_bytes);
+    printf("  receive %.0f us a full message, %.0f us a delta (host)\n", full_messages ? full_us / full_messages : 0.0,
+           delta_us / deltas);
+    TEST_ASSERT_TRUE(delta_bytes + answer_bytes + request_bytes < full_bytes);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_simulated_day);
+    return UNITY_END();
+}
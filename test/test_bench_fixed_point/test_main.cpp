@@ -0,0 +1,45 @@
+#include <unity.h>
+#include <chrono>
+#include <math.h>
+#include "format.h"
+#include "json_stream.h"
+
+//Parse and format cost of weather temperatures: former float path (atof, - 273.15 in float,
+//lround) against fixed point (parseFixed, kelvinToDeci). The host has an FPU, the ESP8266
+//emulates float in software, so the host ratio understates the difference on the device.
+
+static char values[1024][16];
+
+void setUp() {
+    for (int i = 0; i < 1024; i++) snprintf(values[i], sizeof(values[i]), "%d.%02d", 230 + i % 80, (i * 37) % 100);
+}
+void tearDown() {}
+
+template <class Convert>
+static double nsPerValue(Convert convert) {
+    char text[16];
+    volatile char sink = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int round = 0; round < 2000; round++) {
+        for (int i = 0; i < 1024; i++) sink += formatTemperature(text, convert(values[i]))[1];
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (2000 * 1024.0);
+}
+
+void test_parse_and_format_cost() {
+    double floating = nsPerValue([](const char *value) {
+        float temp = atof(value) - 273.15;
+        return lround(temp * 10);
+    });
+    double fixed = nsPerValue([](const char *value) {
+        return kelvinToDeci(parseFixed(value, 2));
+    });
+    printf("  parse and format: float %.1f ns, fixed point %.1f ns (host)\n", floating, fixed);
+    TEST_ASSERT_TRUE(fixed > 0);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_and_format_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,62 @@
+#include <unity.h>
+#include <random>
+#include "flush.h"
+
+//Display transfer of typical frames (23 us per byte): bytes sent and longest loop iteration
+//blocked by the transfer, chunked flush with FLUSH_BUDGET of main.cpp against sendBuffer() of
+//the whole frame. Whole rows of ST7920 in env bench, tile spans of SSD1306 and SH1106 in envs
+//bench_ssd1306 and bench_sh1106. Drawing of the stand-in keeps the ST7920
+//byte layout, so for tile spans only the sparse frames have the byte pattern of the device.
+
+#define FLUSH_BUDGET 4000
+
+static Display::Lcd lcd(DISPLAY_ARGS);
+static std::mt19937 rng(5);
+
+typedef void (*Frame)();
+static void clockSecond() { lcd.setDrawColor(2); lcd.drawBox(2, 56, 28, 8); }     //footer clock digits
+static void clockMinute() { lcd.setDrawColor(2); lcd.drawBox(2, 56, 28, 8); lcd.drawBox(20, 20, 88, 24); }
+static void screenChange() { for (uint8_t &byte : lcd.buffer) byte = rng(); }
+static void sparse() { for (int i = rng() % 5; i > 0; i--) lcd.buffer[rng() % sizeof(lcd.buffer)] ^= 1 << (rng() % 8); }
+
+static void bench(const char *name, Frame frame) {
+    const int frames = 1000;
+    unsigned long chunked_bytes = 0, whole_bytes = 0;
+    uint64_t longest = 0;
+    for (int i = 0; i < frames; i++) {
+        frame();
+        lcd.sent_bytes = 0;
+        flushStart(lcd);
+        while (flushBusy()) {
+            uint64_t start = native_time_us;
+            flushStep(lcd, FLUSH_BUDGET);
+            if (native_time_us - start > longest) longest = native_time_us - start;
+        }
+        chunked_bytes += lcd.sent_bytes;
+        whole_bytes += sizeof(lcd.buffer);
+    }
+    printf("  %-14s chunked %5lu B/frame, longest step %5.1f ms | sendBuffer %lu B/frame, %.1f ms\n", name,
+           chunked_bytes / frames, longest / 1000.0, whole_bytes / frames, sizeof(lcd.buffer) * lcd.byte_us / 1000.0);
+}
+
+void setUp() {
+    lcd.byte_us = 23;
+    flushInvalidate();
+    flushStart(lcd);
+    while (flushBusy()) flushStep(lcd, FLUSH_BUDGET);
+}
+void tearDown() {}
+
+void test_flush_cost() {
+    printf("  %s\n", Display::row_flush ? "whole rows (ST7920)" : "tile spans (SSD1306, SH1106)");
+    bench("clock second", clockSecond);
+    bench("clock minute", clockMinute);
+    bench("sparse", sparse);
+    bench("screen change", screenChange);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_flush_cost);
+    return UNITY_END();
+}
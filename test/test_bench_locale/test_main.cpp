@@ -0,0 +1,80 @@
+#include <unity.h>
+#include <chrono>
+#include <U8g2lib.h>
+#include "locale_pack.h"
+
+//Centering of the texts of all locale packs: offset of the old getStrWidth() centering (bytes of
+//UTF-8 text times the advance) against the drawn text, and host cost of centering a weekday
+//name with the stored width and with stringWidth().
+
+struct Pack {
+    const char *name;
+    const char *texts[7 + LOCALE_LABELS];
+};
+
+static const Pack packs[] = {
+#include "locales/en.h"
+    {"en", {LOCALE_WEEKDAYS, LOCALE_LABEL_TEXTS}},
+#undef LOCALE_WEEKDAYS
+#undef LOCALE_WEEKDAYS_SHORT
+#undef LOCALE_LABEL_TEXTS
+#include "locales/cs.h"
+    {"cs", {LOCALE_WEEKDAYS, LOCALE_LABEL_TEXTS}},
+#undef LOCALE_WEEKDAYS
+#undef LOCALE_WEEKDAYS_SHORT
+#undef LOCALE_LABEL_TEXTS
+#include "locales/de.h"
+    {"de", {LOCALE_WEEKDAYS, LOCALE_LABEL_TEXTS}},
+};
+
+static U8G2 lcd;
+
+void setUp() {}
+void tearDown() {}
+
+void test_centering_offset() {
+    lcd.setFont(u8g2_font_6x12_te);
+    for (const Pack &pack : packs) {
+        int off_center = 0, worst = 0;
+        const char *worst_text = "";
+        for (const char *text : pack.texts) {
+            int drawn = lcd.getUTF8Width(text);
+            TEST_ASSERT_EQUAL_MESSAGE(drawn, stringWidth(text, FONT_6X12_ADVANCE), text);
+            int offset = (lcd.getStrWidth(text) - drawn) / 2;  //old x is this much left of center
+            off_center += offset > 0;
+            if (offset > worst) {
+                worst = offset;
+                worst_text = text;
+            }
+        }
+        printf("  %s: %d of %d texts off center with byte widths, worst %d px (%s), 0 px with stored widths\n",
+               pack.name, off_center, (int)(sizeof(pack.texts) / sizeof(pack.texts[0])), worst, worst_text);
+    }
+}
+
+void test_centering_cost() {
+    const int rounds = 1000000;
+    char buf[LOCALE_TEXT_LEN];
+    volatile int sink = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) sink += localeWeekday(buf, i);
+    double stored = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        localeWeekday(buf, i);
+        sink += stringWidth(buf, FONT_6X12_ADVANCE);
+    }
+    double runtime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+    printf("  weekday copy and width: %.1f ns stored, %.1f ns stringWidth() (host)\n", stored, runtime);
+    TEST_ASSERT_TRUE(sink != 0);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_centering_offset);
+    RUN_TEST(test_centering_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,66 @@
+#include <unity.h>
+#include <FakeNtp.h>
+#include "NTPClient.h"
+
+//Sync traffic of a simulated day (one dead, one 80 ms and one 20 ms server) and time the
+//loop spends blocked in forceUpdate() while no server is reachable.
+
+#define EXCHANGE_BYTES (2 * 76)     //48 byte NTP payload + UDP/IP headers, both directions
+
+static FakeNtpUdp udp;
+static const char *const names[] = {"dead", "slow", "fast"};
+
+//main loop for given virtual time, @return ms spent in forceUpdate()
+static unsigned long runLoop(NTPClient &ntp, unsigned long seconds, int &polls) {
+    unsigned long blocked = 0;
+    for (unsigned long end = millis() + seconds * 1000; millis() < end; delay(1000)) {
+        if (ntp.isUpdateDue()) {
+            unsigned long start = millis();
+            ntp.forceUpdate();
+            blocked += millis() - start;
+            polls++;
+        }
+    }
+    return blocked;
+}
+
+void setUp() {
+    native_time_us = 0;
+    udp.servers.clear();
+}
+void tearDown() {}
+
+void test_day_of_sync_traffic() {
+    udp.servers["dead"].up = false;
+    udp.servers["slow"].rtt = 80;
+    udp.servers["fast"].rtt = 20;
+    NTPClient ntp(udp, names, 3);
+    ntp.begin();
+
+    int polls = 0;
+    runLoop(ntp, 86400, polls);
+    unsigned long requests = 0;
+    for (const char *name : names) requests += udp.servers[name].requests;
+    printf("  %d updates, %lu requests/day (%lu bytes, 60 s fixed interval: %lu bytes), server %s, error %lld s\n",
+           polls, requests, requests * EXCHANGE_BYTES, 1440UL * EXCHANGE_BYTES, ntp.getServer().name,
+           (long long)ntp.getEpochTime64() - (long long)((native_ntp_epoch_ms + millis()) / 1000));
+    TEST_ASSERT_EQUAL_STRING("fast", ntp.getServer().name);
+}
+
+void test_unreachable_network() {
+    for (const char *name : names) udp.servers[name].up = false;
+    NTPClient ntp(udp, names, 3);
+    ntp.begin();
+
+    int polls = 0;
+    unsigned long blocked = runLoop(ntp, 3600, polls);
+    printf("  no server for an hour: %d updates, loop blocked %lu ms (%.1f%%)\n", polls, blocked, blocked / 36000.0);
+    TEST_ASSERT_TRUE(blocked < 3600000 / 10);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_day_of_sync_traffic);
+    RUN_TEST(test_unreachable_network);
+    return UNITY_END();
+}
@@ -0,0 +1,54 @@
+#include <unity.h>
+#include <random>
+#include <FakeNtp.h>
+#include "NTPClient.h"
+
+//Polls across the 2036 NTP era rollover while two of three answers are preceded by garbage,
+//bit-flipped, truncated or wrong-originate datagrams. No forged datagram may move the clock.
+//Bit flips stay out of the transmit timestamp: an answer echoing our originate is the real one
+//as far as unauthenticated NTP can tell.
+
+#define POLLS 20000
+
+static FakeNtpUdp udp;
+static std::mt19937 rng(42);
+
+void setUp() {}
+void tearDown() {}
+
+void test_fuzz_across_era_rollover() {
+    native_time_us = 0;
+    native_ntp_epoch_ms = (2085978496ULL - 3600) * 1000;    //an hour before the rollover
+    udp.forge = [](std::vector<std::vector<uint8_t>> &packets) {
+        if (rng() % 3 == 0) return;
+        std::vector<uint8_t> forged = packets[0];
+        switch (rng() % 4) {
+            case 0: for (uint8_t &b : forged) b = rng(); break;                 //garbage
+            case 1: forged[rng() % 40] ^= 1 << (rng() % 8); break;              //bit flip in header, reference or originate
+            case 2: forged.resize(rng() % 48); break;                           //truncated
+            case 3: forged[24 + rng() % 8] ^= 0xFF; forged[41] ^= 0x10; break;  //stale request, other time
+        }
+        packets.insert(packets.begin(), forged);
+    };
+
+    NTPClient ntp(udp, "fast");
+    ntp.begin();
+    long synced = 0, failed = 0, max_error = 0;
+    for (int i = 0; i < POLLS; i++) {
+        if (ntp.forceUpdate()) synced++;
+        else failed++;
+        long error = labs((long)((long long)ntp.getEpochTime64() - (long long)((native_ntp_epoch_ms + millis()) / 1000)));
+        if (ntp.isTimeSet()) max_error = max(max_error, error);
+        delay(997);
+    }
+    printf("  %d polls: %ld synced, %ld failed, max error %ld s, ends %llu s after the rollover\n", POLLS, synced, failed,
+           max_error, (unsigned long long)(ntp.getEpochTime64() - 2085978496ULL));
+    TEST_ASSERT_TRUE(max_error <= 1);
+    TEST_ASSERT_TRUE(ntp.getEpochTime64() > 2085978496ULL);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_fuzz_across_era_rollover);
+    return UNITY_END();
+}
@@ -0,0 +1,83 @@
+#include <unity.h>
+#include <chrono>
+#include <OneCall.h>
+#include "main.cpp"
+
+//Parse time and memory of One Call messages like the API sends them (61 minutes, 48 hours and
+//8 days), without alerts and with two alerts of about 1 kB. Messages are fed byte by byte like
+//PubSubClient hands them over, once to the weather parser alone and once to the weather and delta
+//parsers as WeatherWriter does (without its cycle counter reads, the stand-in reads the host
+//clock for them), every parse has to complete.
+
+#define ROUNDS 200
+
+static const char *two_alerts =
+    "{\"sender_name\": \"Czech Hydrometeorological Institute\", \"event\": \"Thunderstorms\", \"start\": 1700000000, "
+    "\"end\": 1700021600, \"description\": \"Severe thunderstorms with heavy rain, hail and wind gusts up to 90 km/h are "
+    "expected in the afternoon and evening. Local flash floods are possible. Secure loose objects, avoid staying "
+    "outdoors and under trees, do not drive through flooded roads. Thunderstorms can be locally accompanied by hail "
+    "up to 2 cm and rainfall of 30 to 50 mm in a short time. Follow further warnings.\", \"tags\": [\"Thunderstorm\"]}, "
+    "{\"sender_name\": \"Czech Hydrometeorological Institute\", \"event\": \"High temperatures\", \"start\": 1700000000, "
+    "\"end\": 1700086400, \"description\": \"Maximum temperatures will reach 31 to 34 degrees Celsius, locally up to "
+    "36 degrees. Drink enough fluids, avoid physical exertion during the hottest part of the day, do not leave "
+    "children or animals in parked cars and take care of elderly and sick people. Increased risk of fires in forests "
+    "and on fields, do not make fires in nature.\", \"tags\": [\"Extreme temperature value\"]}";
+
+static double hostUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+//host time of one message fed byte by byte to the weather parser alone
+static double parseUs(const std::string &payload) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        parsed_weather = CityWeather();
+        weather_json.reset();
+        for (char c : payload) weather_json.feed(c);
+        TEST_ASSERT_TRUE(weather_json.done());
+    }
+    return hostUs(start) / ROUNDS;
+}
+
+//host time of one message fed byte by byte to the weather and delta parsers
+static double receiveUs(const std::string &payload) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        resetWeatherStream();
+        for (char c : payload) {
+            weather_json.feed(c);
+            if (!weather_delta.foreign) delta_json.feed(c);
+        }
+        TEST_ASSERT_TRUE(weather_json.done());
+        TEST_ASSERT_TRUE(weather_delta.foreign);
+    }
+    return hostUs(start) / ROUNDS;
+}
+
+static void bench(const char *name, const std::string &payload) {
+    double parse = parseUs(payload), receive = receiveUs(payload);
+    printf("  %s: %u B, parse %.0f us (%.1f us a kB), both parsers %.0f us (host)\n", name, (unsigned)payload.size(),
+           parse, parse * 1000 / payload.size(), receive);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_parser_memory() {
+    printf("  weather parser %u B (JsonStream), staging record %u B (CityWeather), document was 6144 B\n",
+           (unsigned)sizeof(weather_json), (unsigned)sizeof(parsed_weather));
+    TEST_ASSERT_TRUE(sizeof(weather_json) + sizeof(parsed_weather) < 6144);
+}
+
+void test_parse_time() {
+    bench("without alerts", oneCall(1700000000, ""));
+    bench("two alerts", oneCall(1700000000, two_alerts));
+    TEST_ASSERT_EQUAL(1700021600, parsed_weather.alerts[0].end);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_parser_memory);
+    RUN_TEST(test_parse_time);
+    return UNITY_END();
+}
@@ -0,0 +1,62 @@
+#include <unity.h>
+#include <OneCall.h>
+#include "main.cpp"
+
+//Receive path of weather data: RAM it takes against the 8 kB MQTT buffer and 6 kB JSON document
+//it replaced, and the largest messages it accepts. Messages go through the PubSubClient stand-in
+//(payload streamed to the parsers while it is received, callback gets it cut to MQTT_BUFFER)
+//into main.cpp. One Call messages grow by alerts with long descriptions up to 4 MB, every one
+//has to update the city's weather.
+
+static uint32_t utcNow() {
+    return time_client.getEpochTime() - time_offset;
+}
+
+static std::string alerts(size_t bytes, uint32_t dt) {
+    std::string text;
+    for (int i = 0; text.size() < bytes; i++) {
+        if (i) text += ", ";
+        appendf(text, "{\"sender_name\": \"Czech Hydrometeorological Institute\", \"event\": \"Storm %d\", "
+                      "\"start\": %u, \"end\": %u, \"description\": \"", i, dt, dt + 6 * 3600);
+        for (int line = 0; line < 40; line++) text += "Severe thunderstorms with heavy rain and hail are expected. ";
+        text += "\", \"tags\": [\"Thunderstorm\"]}";
+    }
+    return text;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_receive_ram() {
+    unsigned buffers = MQTT_BUFFER + sizeof(parsed_weather) + sizeof(weather_json) + sizeof(weather_delta) + sizeof(delta_json);
+    printf("  MQTT buffer %d B, staging record %u B, weather parser %u B, delta %u B, delta parser %u B\n", MQTT_BUFFER,
+           (unsigned)sizeof(parsed_weather), (unsigned)sizeof(weather_json), (unsigned)sizeof(weather_delta),
+           (unsigned)sizeof(delta_json));
+    printf("  receive path %u B (was 8192 B buffer and 6144 B document = 14336 B)\n", buffers);
+    TEST_ASSERT_TRUE(buffers < 8192 + 6144);
+}
+
+void test_largest_payload() {
+    setup();
+    unsigned long end = millis() + 10000;
+    while ((long)(millis() - end) < 0) loop();      //connected and subscribed
+
+    size_t largest = 0;
+    for (size_t bytes = 0; bytes <= 4096000; bytes = bytes ? bytes * 4 : 16000) {
+        uint32_t dt = utcNow();
+        std::string payload = oneCall(dt, alerts(bytes, dt).c_str());
+        client.inbox.push_back({millis(), "weather/Random City", payload, false});
+        while (!client.inbox.empty()) loop();
+        TEST_ASSERT_EQUAL_MESSAGE(dt, weather[0].dt, "message dropped");
+        TEST_ASSERT_TRUE(!bytes || weather[0].alerts[0].end);
+        largest = payload.size();
+    }
+    printf("  largest accepted message %u kB (only the MQTT packet length limits it)\n", (unsigned)(largest / 1000));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_receive_ram);
+    RUN_TEST(test_largest_payload);
+    return UNITY_END();
+}
@@ -0,0 +1,64 @@
+#include <unity.h>
+#include <OneCall.h>
+#include "main.cpp"
+
+//Duty cycle of power_save with the default timings (1 s footer, 4 s screens), read from the
+//"power" line of the firmware's own metrics over one hour. The firmware (main.cpp) runs on the
+//stand-ins with the host CPU time charged x40 (ESP8266 at 80 MHz), the ST7920 taking 23 us per
+//byte and the AM2320 read taking 3 ms. Host scheduling hiccups are charged too, so the awake
+//share varies a little between runs.
+
+#define CPU_SCALE 40
+
+static const char *metrics_topic = "devices/Device name/metrics";
+
+static uint32_t utcNow() {
+    return time_client.getEpochTime() - time_offset;
+}
+
+static void runFor(unsigned long ms) {
+    unsigned long end = millis() + ms;
+    while ((long)(millis() - end) < 0) loop();
+}
+
+static void hour(bool power_save) {
+    config.power_save = power_save;
+    powerMode(power_save);
+    runFor(MINUTE);
+    client.sent.clear();
+    runFor(60 * MINUTE);
+
+    unsigned long awake = 0, wakeups = 0;
+    int reports = 0;
+    for (const MqttMessage &message : client.sent) {
+        if (message.topic != metrics_topic) continue;
+        const char *line = strstr(message.payload.c_str(), "power ");
+        TEST_ASSERT_NOT_NULL(line);
+        unsigned long a, w;
+        TEST_ASSERT_EQUAL(2, sscanf(line, "power %lu %lu", &a, &w));
+        awake += a;
+        wakeups += w;
+        reports++;
+    }
+    TEST_ASSERT_EQUAL(60, reports);
+    printf("  power_save %d: %lu permille awake, %lu wake-ups per hour\n", power_save, awake / reports, wakeups / reports);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_duty_cycle() {
+    u8g2.byte_us = 23;
+    setup();
+    client.retained["weather/Random City"] = {0, "weather/Random City", oneCall(utcNow(), ""), true};
+    runFor(MINUTE);
+    native_cpu_scale = CPU_SCALE;
+    hour(false);
+    hour(true);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_duty_cycle);
+    return UNITY_END();
+}
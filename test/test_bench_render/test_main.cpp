@@ -0,0 +1,57 @@
+#include <unity.h>
+#include <OneCall.h>
+#include "main.cpp"
+
+//Widget redraws and display sends of one hour with the default timings (1 s footer, 4 s screens)
+//and new weather every 30 min, read from the "render" line of the firmware's own metrics. The
+//firmware (main.cpp) runs on the stand-ins in virtual time, the ST7920 takes 23 us per byte.
+
+static const char *metrics_topic = "devices/Device name/metrics";
+
+static uint32_t utcNow() {
+    return time_client.getEpochTime() - time_offset;
+}
+
+static void runFor(unsigned long ms) {
+    unsigned long end = millis() + ms;
+    while ((long)(millis() - end) < 0) loop();
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_render_hour() {
+    u8g2.byte_us = 23;
+    setup();
+    client.retained["weather/Random City"] = {0, "weather/Random City", oneCall(utcNow(), ""), true};
+    runFor(2 * MINUTE);
+    client.sent.clear();
+
+    //hour of reports (each one is the rate of its minute)
+    unsigned long redraws = 0, sends = 0, bytes = 0, sent_bytes = u8g2.sent_bytes;
+    int reports = 0;
+    for (int half = 0; half < 2; half++) {
+        client.inbox.push_back({millis(), "weather/Random City", oneCall(utcNow(), ""), false});
+        runFor(30 * MINUTE);
+    }
+    for (const MqttMessage &message : client.sent) {
+        if (message.topic != metrics_topic) continue;
+        const char *line = strstr(message.payload.c_str(), "render ");
+        TEST_ASSERT_NOT_NULL(line);
+        unsigned long r, s, b;
+        TEST_ASSERT_EQUAL(3, sscanf(line, "render %lu %lu %lu", &r, &s, &b));
+        redraws += r;
+        sends += s;
+        bytes += b;
+        reports++;
+    }
+    TEST_ASSERT_EQUAL(60, reports);
+    printf("  per hour: %lu widget redraws, %lu sends, %lu kB sent (display stand-in %lu kB)\n", redraws / reports,
+           sends / reports, bytes / reports / 1000, (u8g2.sent_bytes - sent_bytes) / 1000);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_render_hour);
+    return UNITY_END();
+}
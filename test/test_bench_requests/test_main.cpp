@@ -0,0 +1,135 @@
+#include <unity.h>
+#include <deque>
+#include "main.cpp"
+
+//Weather requests of 100 stations rebooted together (power outage, broker restart). The stations
+//run the firmware's connect, receive and request code (onConnected(), PubSubClient stand-in with
+//the streaming parser, sendRequests()) one after another on a shared virtual clock, each with its
+//own request and weather record swapped in. They connect within 2 s, get the retained message on
+//subscribing and the publisher answers every request after 2 s with new retained data delivered
+//to all stations. Broker messages are requests plus deliveries, averaged over random seeds.
+
+#define STATIONS 100
+#define SEEDS 50
+#define ANSWER_MS 2000
+#define STEP_MS 10
+
+struct Station {
+    unsigned long connect_at;
+    bool connected;
+    WeatherRequest request;
+    CityWeather weather;
+    std::deque<MqttMessage> inbox;
+};
+static Station stations[STATIONS];
+static const char *weather_topic = "weather/Prague";
+static bool booted = false;
+
+static std::string snapshot(uint32_t dt) {
+    return "{\"current\": {\"dt\": " + std::to_string(dt) + ", \"temp\": 288.4}}";
+}
+
+static uint32_t utcNow() {
+    return time_client.getEpochTime() - time_offset;
+}
+
+static void enter(Station &station) {
+    requests[0] = station.request;
+    weather[0] = station.weather;
+    client.inbox.swap(station.inbox);
+}
+
+static void leave(Station &station) {
+    station.request = requests[0];
+    station.weather = weather[0];
+    client.inbox.swap(station.inbox);
+}
+
+//broker messages of one reboot, requests counted separately
+static void reboot(bool fresh, unsigned long &requests_sent, unsigned long &messages, int &without_data) {
+    std::string retained = snapshot(fresh ? utcNow() : utcNow() - 3 * 3600);
+    std::deque<unsigned long> answers;  //due times of publisher answers
+    unsigned long start = millis();
+    for (Station &station : stations) {
+        station = Station();
+        station.connect_at = start + random(2000);
+    }
+
+    while (millis() - start < 60000) {
+        native_time_us += STEP_MS * 1000;
+        while (!answers.empty() && answers.front() <= millis()) {
+            answers.pop_front();
+            retained = snapshot(utcNow());
+            for (Station &station : stations) {
+                if (!station.connected) continue;
+                station.inbox.push_back({millis(), weather_topic, retained, true});
+                messages++;
+            }
+        }
+        for (Station &station : stations) {
+            if (!station.connected && millis() < station.connect_at) continue;
+            enter(station);
+            if (!station.connected) {
+                station.connected = true;
+                client.inbox.push_back({millis(), weather_topic, retained, true});
+                messages++;
+                onConnected();
+            }
+            client.loop();
+            sendRequests();
+            for (const MqttMessage &message : client.sent) {
+                if (message.topic != "weather/requests/Prague") continue;
+                requests_sent++;
+                messages++;
+                answers.push_back(millis() + ANSWER_MS);
+            }
+            client.sent.clear();
+            leave(station);
+        }
+    }
+    for (Station &station : stations) {
+        enter(station);
+        without_data += weatherStale(0);
+        leave(station);
+    }
+}
+
+static void bench(bool fresh) {
+    unsigned long requests_sent = 0, messages = 0;
+    int without_data = 0;
+    for (int seed = 0; seed < SEEDS; seed++) {
+        srand(seed);
+        reboot(fresh, requests_sent, messages, without_data);
+    }
+    printf("  retained data %s: %.1f requests, %.0f broker messages per reboot, %d stations without data\n",
+           fresh ? "fresh" : "stale", requests_sent / (double)SEEDS, messages / (double)SEEDS, without_data);
+    TEST_ASSERT_EQUAL(0, without_data);
+}
+
+void setUp() {
+    if (booted) return;
+    setup();
+    config.city_count = 1;
+    strcpy(config.cities[0], "Prague");
+    client.loop_us = 0;
+    client.connect(config.device_name);
+    client.subscribe(weather_topic);
+    booted = true;
+}
+void tearDown() {}
+
+void test_stale_retained_data() {
+    bench(false);
+    printf("  every station requesting: %d requests, %d broker messages\n", STATIONS, STATIONS + STATIONS + STATIONS * STATIONS);
+}
+
+void test_fresh_retained_data() {
+    bench(true);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_stale_retained_data);
+    RUN_TEST(test_fresh_retained_data);
+    return UNITY_END();
+}
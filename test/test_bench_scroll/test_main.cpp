@@ -0,0 +1,57 @@
+#include <unity.h>
+#include <chrono>
+#include <random>
+#include "blit.h"
+
+//Forecast scrolling: day columns (43x54 with separator) are rendered once, captured by
+//blitCapture() and every frame copies the visible ones by blitXBM(). Frames are checked
+//pixel-exact against the captured columns at every offset, cost is host time per frame.
+
+#define FORECAST_COLUMN 43
+#define FORECAST_HEIGHT 54
+#define FORECAST_DAYS 7
+
+static U8G2 lcd;
+static uint8_t tiles[FORECAST_DAYS][(FORECAST_COLUMN + 7) / 8 * FORECAST_HEIGHT];
+static bool columns[FORECAST_DAYS][FORECAST_HEIGHT][FORECAST_COLUMN];
+
+void setUp() {}
+void tearDown() {}
+
+void test_scroll_frames() {
+    std::mt19937 rng(9);
+    for (int day = 0; day < FORECAST_DAYS; day++) {
+        for (uint8_t &byte : lcd.buffer) byte = rng();      //stands for the rendered column
+        for (int y = 0; y < FORECAST_HEIGHT; y++) {
+            for (int x = 0; x < FORECAST_COLUMN; x++) columns[day][y][x] = lcd.getPixel(x, y);
+        }
+        blitCapture<FORECAST_COLUMN, FORECAST_HEIGHT>(lcd, 0, tiles[day]);
+    }
+
+    double ns = 0;
+    int frames = 0, wrong = 0;
+    for (int offset = 0; offset <= FORECAST_DAYS * FORECAST_COLUMN - 128; offset++, frames++) {
+        lcd.clearBuffer();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int day = 0; day < FORECAST_DAYS; day++) {
+            int x = day * FORECAST_COLUMN - offset;
+            if (x > -FORECAST_COLUMN && x < 128) blitXBM<FORECAST_COLUMN, FORECAST_HEIGHT>(lcd, x, 0, tiles[day]);
+        }
+        ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        for (int y = 0; y < FORECAST_HEIGHT; y++) {
+            for (int x = 0; x < 128; x++) {
+                int column = x + offset;
+                wrong += lcd.getPixel(x, y) != columns[column / FORECAST_COLUMN][y][column % FORECAST_COLUMN];
+            }
+        }
+    }
+    printf("  %d frames, %d wrong pixels, %.0f ns per frame (host)\n", frames, wrong, ns / frames);
+    TEST_ASSERT_EQUAL(0, wrong);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_scroll_frames);
+    return UNITY_END();
+}
@@ -0,0 +1,61 @@
+#include <unity.h>
+#include <chrono>
+#include <time.h>
+#include "timezone.h"
+
+//Timezone against the host C library (glibc TZ rules) at many instants of 2000-2050,
+//and lookup cost with and without crossing transitions.
+
+static const char *const zones[] = {
+    "CET-1CEST,M3.5.0,M10.5.0/3", "EST5EDT,M3.2.0,M11.1.0", "AEST-10AEDT,M10.1.0,M4.1.0/3",
+    "NZST-12NZDT,M9.5.0,M4.1.0/3", "<+03>-3", "IST-5:30", "GMT0BST,M3.5.0/1,M10.5.0", NULL
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_matches_libc() {
+    long mismatches = 0, total = 0;
+    for (const char *const *zone = zones; *zone; zone++) {
+        Timezone tz;
+        TEST_ASSERT_TRUE_MESSAGE(tz.set(*zone), *zone);
+        setenv("TZ", *zone, 1);
+        tzset();
+        for (long long t = 946684800LL; t < 2524608000LL; t += 1800 + t % 7) {
+            time_t utc = t;
+            struct tm local;
+            localtime_r(&utc, &local);
+            total++;
+            if (tz.offset((unsigned long)t) != local.tm_gmtoff) {
+                if (mismatches++ < 5) printf("  %s at %lld: %ld, libc %ld\n", *zone, t, tz.offset((unsigned long)t), (long)local.tm_gmtoff);
+            }
+        }
+    }
+    printf("  %ld instants, %ld mismatches\n", total, mismatches);
+    TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+void test_lookup_cost() {
+    Timezone tz;
+    tz.set(zones[0]);
+    volatile long sink = 0;
+
+    //every second of a day (cached) and one instant a day for 50 years (new transitions every half year)
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100; i++) for (unsigned long t = 1720000000; t < 1720000000 + 86400; t++) sink += tz.offset(t);
+    double cached = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (100 * 86400.0);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100; i++) for (unsigned long t = 946684800; t < 2524608000UL; t += 86400) sink += tz.offset(t);
+    double sweep = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (100 * 18263.0);
+
+    printf("  offset(): %.1f ns cached, %.1f ns stepping a day (host)\n", cached, sweep);
+    TEST_ASSERT_TRUE(sink != 0);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_matches_libc);
+    RUN_TEST(test_lookup_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,87 @@
+#include <unity.h>
+#include <random>
+#include "blit.h"
+
+static U8G2 lcd;
+static std::mt19937 rng(1);
+static uint8_t expected[sizeof(lcd.buffer)];
+
+static void randomize(uint8_t *bytes, size_t size) {
+    for (size_t i = 0; i < size; i++) bytes[i] = rng();
+}
+
+//blitXBM() against drawXBM() of the stand-in (solid bitmap mode) at every x and every third y
+//from fully outside to fully outside the buffer, over random background
+template <uint8_t W, uint8_t H>
+static void compareXBM() {
+    static uint8_t bits[(W + 7) / 8 * H];
+    randomize(bits, sizeof(bits));
+    for (int x = -W - 3; x <= 131; x++) {
+        for (int y = -H - 2; y <= 66; y += 3) {
+            randomize(lcd.buffer, sizeof(lcd.buffer));
+            memcpy(expected, lcd.buffer, sizeof(expected));
+            lcd.drawXBM(x, y, W, H, bits);
+            std::swap_ranges(expected, expected + sizeof(expected), lcd.buffer);
+            blitXBM<W, H>(lcd, x, y, bits);
+            char message[32];
+            snprintf(message, sizeof(message), "%dx%d at %d,%d", W, H, x, y);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, lcd.buffer, sizeof(expected), message);
+        }
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+//sizes of the icons and forecast tiles drawn by main.cpp
+void test_xbm_matches_u8g2() {
+    compareXBM<64, 42>();
+    compareXBM<40, 30>();
+    compareXBM<11, 12>();
+    compareXBM<15, 7>();
+    compareXBM<11, 11>();
+    compareXBM<6, 6>();
+    compareXBM<43, 54>();     //forecast tiles
+}
+
+void test_row_layout() {
+    lcd.clearBuffer();
+    lcd.drawPixel(0, 0);
+    lcd.drawPixel(9, 5);
+    TEST_ASSERT_EQUAL(0x01, blitRow(lcd, 0)[0]);
+    TEST_ASSERT_EQUAL(0x02, blitRow(lcd, 5)[-1]);   //pixel 9 is bit 1 of the next byte
+}
+
+void test_bits_and_xor_clip() {
+    lcd.clearBuffer();
+    uint8_t *row = blitRow(lcd, 10);
+    blitBits(row, lcd.getBufferTileWidth(), -4, 0xFFFFFF, 0xFFFFFF);    //pixels -4..19
+    for (int x = 0; x < 128; x++) TEST_ASSERT_EQUAL(x < 20, lcd.getPixel(x, 10));
+    blitBits(row, lcd.getBufferTileWidth(), 4, 0x0, 0xF);               //mask clears
+    for (int x = 0; x < 128; x++) TEST_ASSERT_EQUAL(x < 4 || (x >= 8 && x < 20), lcd.getPixel(x, 10));
+    blitXor(row, lcd.getBufferTileWidth(), 120, 0xFFFF);                //pixels 120..135
+    for (int x = 0; x < 128; x++) TEST_ASSERT_EQUAL(x < 4 || (x >= 8 && x < 20) || x >= 120, lcd.getPixel(x, 10));
+    for (int y = 0; y < 64; y++) if (y != 10) for (int x = 0; x < 128; x++) TEST_ASSERT_FALSE(lcd.getPixel(x, y));
+}
+
+//forecast tiles are captured and drawn back while scrolling
+void test_capture_restores() {
+    static uint8_t bits[(43 + 7) / 8 * 54];
+    randomize(lcd.buffer, sizeof(lcd.buffer));
+    memcpy(expected, lcd.buffer, sizeof(expected));
+    blitCapture<43, 54>(lcd, 5, bits);
+    lcd.setDrawColor(0);
+    lcd.drawBox(0, 5, 43, 54);
+    lcd.setDrawColor(1);
+    blitXBM<43, 54>(lcd, 0, 5, bits);
+    TEST_ASSERT_EQUAL_MEMORY(expected, lcd.buffer, sizeof(expected));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_xbm_matches_u8g2);
+    RUN_TEST(test_row_layout);
+    RUN_TEST(test_bits_and_xor_clip);
+    RUN_TEST(test_capture_restores);
+    return UNITY_END();
+}
@@ -0,0 +1,226 @@
+#include <unity.h>
+#include <string>
+#include <EEPROM.h>
+#include "config.h"
+
+static Config defaults;
+
+static uint32_t crc32(const uint8_t *data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    while (length--) {
+        crc ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+//store image of older layout: fields up to used, garbage (tail padding) up to size
+static Config &storeImage(const Config &fields, uint8_t version, size_t used, size_t size) {
+    memset(EEPROM.data, 0xA5, sizeof(EEPROM.data));
+    memcpy(EEPROM.data, &fields, used);
+    Config &image = *(Config *)EEPROM.data;
+    image.magic   = CONFIG_MAGIC;
+    image.version = version;
+    image.size    = size;
+    image.writes  = 3;
+    image.crc     = crc32(EEPROM.data + CONFIG_HEADER_SIZE, size - CONFIG_HEADER_SIZE);
+    return image;
+}
+
+//stored fields of version 1 (sizes as stored by firmware of that version)
+static Config storedFields() {
+    Config fields = Config();
+    strlcpy(fields.ssid, "stored", sizeof(fields.ssid));
+    strlcpy(fields.passw, "stored passw", sizeof(fields.passw));
+    strlcpy(fields.cities[0], "Brno", CONFIG_CITY_LEN);
+    strlcpy(fields.cities[1], "Ostrava", CONFIG_CITY_LEN);
+    fields.city_count = 2;
+    fields.time_offset = 3600;
+    fields.temp_calibration = 1000;
+    fields.footer_time = 2000;
+    fields.screen_time = 6000;
+    return fields;
+}
+
+static bool parse(Config &config, const std::string &text) {
+    return configParse(config, (const byte *)text.data(), text.size());
+}
+
+void setUp() {
+    defaults = Config();
+    strlcpy(defaults.ssid, "home", sizeof(defaults.ssid));
+    strlcpy(defaults.passw, "secret", sizeof(defaults.passw));
+    strlcpy(defaults.cities[0], "Prague", CONFIG_CITY_LEN);
+    defaults.city_count = 1;
+    defaults.footer_time = 1000;
+    defaults.screen_time = 4000;
+    strlcpy(defaults.timezone, "CET-1CEST,M3.5.0,M10.5.0/3", sizeof(defaults.timezone));
+    defaults.latitude = 500755;
+    defaults.longitude = 144378;
+    EEPROM.commits = 0;
+}
+void tearDown() {}
+
+void test_parse_values() {
+    Config config = defaults;
+    TEST_ASSERT_TRUE(parse(config, "{\"cities\": [\"Brno\", \"Ostrava\"], \"timezone\": \"UTC0\", \"temp_calibration\": 0.95, "
+                                   "\"screen_time\": 10, \"power_save\": true, \"latitude\": 50.0755, \"longitude\": -14.4378}"));
+    TEST_ASSERT_EQUAL(2, config.city_count);
+    TEST_ASSERT_EQUAL_STRING("Ostrava", config.cities[1]);
+    TEST_ASSERT_EQUAL_STRING("UTC0", config.timezone);
+    TEST_ASSERT_EQUAL(950, config.temp_calibration);
+    TEST_ASSERT_EQUAL(100, config.screen_time);     //clamped
+    TEST_ASSERT_EQUAL(1, config.power_save);
+    TEST_ASSERT_EQUAL(500755, config.latitude);
+    TEST_ASSERT_EQUAL(-144378, config.longitude);
+    TEST_ASSERT_EQUAL_STRING("home", config.ssid);  //keys not in the message are kept
+}
+
+void test_parse_invalid_keeps_config() {
+    Config config = defaults;
+    TEST_ASSERT_FALSE(parse(config, "{\"ssid\": \"other\", \"cities\": [\"Brno\""));   //incomplete
+    TEST_ASSERT_FALSE(parse(config, "{\"ssid\": \"other\", \"cities\": [1, 2],}"));     //invalid
+    TEST_ASSERT_EQUAL_STRING("home", config.ssid);
+    TEST_ASSERT_EQUAL_STRING("Prague", config.cities[0]);
+}
+
+void test_parse_password_length() {
+    //64 characters is the longest WPA2 key (hex form of the key)
+    std::string passw(64, 'k');
+    Config config = defaults;
+    TEST_ASSERT_TRUE(parse(config, "{\"passw\": \"" + passw + "\"}"));
+    TEST_ASSERT_EQUAL_STRING(passw.c_str(), config.passw);
+
+    //longer values are rejected, not cut
+    config = defaults;
+    TEST_ASSERT_FALSE(parse(config, "{\"ssid\": \"other\", \"passw\": \"" + passw + "k\"}"));
+    TEST_ASSERT_EQUAL_STRING("secret", config.passw);
+    TEST_ASSERT_EQUAL_STRING("home", config.ssid);
+}
+
+void test_parse_rejects_long_strings() {
+    Config config = defaults;
+    TEST_ASSERT_TRUE(parse(config, "{\"ssid\": \"" + std::string(32, 's') + "\"}"));
+    TEST_ASSERT_FALSE(parse(config, "{\"ssid\": \"" + std::string(33, 's') + "\"}"));
+    TEST_ASSERT_FALSE(parse(config, "{\"device_name\": \"" + std::string(32, 'd') + "\"}"));
+    TEST_ASSERT_FALSE(parse(config, "{\"cities\": [\"" + std::string(CONFIG_CITY_LEN, 'c') + "\"]}"));
+    TEST_ASSERT_TRUE(parse(config, "{\"cities\": [\"" + std::string(CONFIG_CITY_LEN - 1, 'c') + "\"]}"));
+    TEST_ASSERT_EQUAL(CONFIG_CITY_LEN - 1, strlen(config.cities[0]));
+}
+
+void test_parse_temp_calibration_range() {
+    Config config = defaults;
+    TEST_ASSERT_TRUE(parse(config, "{\"temp_calibration\": 9.999}"));
+    TEST_ASSERT_EQUAL(9999, config.temp_calibration);
+    TEST_ASSERT_FALSE(parse(config, "{\"temp_calibration\": 33}"));     //would overflow int16_t
+    TEST_ASSERT_FALSE(parse(config, "{\"temp_calibration\": 0}"));
+    TEST_ASSERT_FALSE(parse(config, "{\"temp_calibration\": -1.2}"));
+    TEST_ASSERT_EQUAL(9999, config.temp_calibration);
+}
+
+void test_load_missing_uses_defaults() {
+    memset(EEPROM.data, 0xFF, sizeof(EEPROM.data));
+    Config config;
+    TEST_ASSERT_FALSE(configLoad(config, defaults));
+    TEST_ASSERT_EQUAL_STRING("home", config.ssid);
+    TEST_ASSERT_EQUAL(CONFIG_VERSION, config.version);
+    TEST_ASSERT_EQUAL(sizeof(Config), config.size);
+}
+
+void test_load_current_layout() {
+    Config fields = storedFields();
+    strlcpy(fields.timezone, "UTC0", sizeof(fields.timezone));
+    fields.power_save = 1;
+    fields.latitude = -338688;
+    storeImage(fields, CONFIG_VERSION, sizeof(Config), sizeof(Config));
+
+    Config config;
+    TEST_ASSERT_TRUE(configLoad(config, defaults));
+    TEST_ASSERT_EQUAL_STRING("stored passw", config.passw);
+    TEST_ASSERT_EQUAL_STRING("UTC0", config.timezone);
+    TEST_ASSERT_EQUAL(1, config.power_save);
+    TEST_ASSERT_EQUAL(-338688, config.latitude);
+    TEST_ASSERT_EQUAL(0, config.longitude);
+}
+
+void test_migrate_version_1() {
+    //version 1 ended with screen_time at 422 + 2 bytes of tail padding (timezone starts at 426)
+    TEST_ASSERT_EQUAL(426, offsetof(Config, timezone));
+    storeImage(storedFields(), 1, offsetof(Config, timezone), 428);
+
+    Config config;
+    TEST_ASSERT_TRUE(configLoad(config, defaults));
+    TEST_ASSERT_EQUAL_STRING("stored", config.ssid);
+    TEST_ASSERT_EQUAL_STRING("stored passw", config.passw);
+    TEST_ASSERT_EQUAL(2, config.city_count);
+    TEST_ASSERT_EQUAL_STRING("Ostrava", config.cities[1]);
+    TEST_ASSERT_EQUAL(3600, config.time_offset);
+    TEST_ASSERT_EQUAL(6000, config.screen_time);
+    TEST_ASSERT_EQUAL_STRING(defaults.timezone, config.timezone);   //padding is not copied into it
+    TEST_ASSERT_EQUAL(0, config.power_save);
+    TEST_ASSERT_EQUAL(500755, config.latitude);
+    TEST_ASSERT_EQUAL(144378, config.longitude);
+
+    //migrated layout is written once the save delay passes
+    delay(CONFIG_SAVE_DELAY);
+    configLoop(config);
+    TEST_ASSERT_EQUAL(1, EEPROM.commits);
+    const Config &stored = *(const Config *)EEPROM.data;
+    TEST_ASSERT_EQUAL(CONFIG_VERSION, stored.version);
+    TEST_ASSERT_EQUAL(sizeof(Config), stored.size);
+    TEST_ASSERT_EQUAL(4, stored.writes);
+
+    Config reloaded;
+    TEST_ASSERT_TRUE(configLoad(reloaded, Config()));
+    TEST_ASSERT_EQUAL(0, memcmp((const uint8_t *)&config + CONFIG_HEADER_SIZE, (const uint8_t *)&reloaded + CONFIG_HEADER_SIZE,
+                                sizeof(Config) - CONFIG_HEADER_SIZE));
+}
+
+void test_migrate_version_3() {
+    Config fields = storedFields();
+    strlcpy(fields.timezone, "EST5EDT,M3.2.0,M11.1.0", sizeof(fields.timezone));
+    fields.power_save = 1;
+    storeImage(fields, 3, offsetof(Config, latitude), offsetof(Config, latitude));
+
+    Config config;
+    TEST_ASSERT_TRUE(configLoad(config, defaults));
+    TEST_ASSERT_EQUAL_STRING("EST5EDT,M3.2.0,M11.1.0", config.timezone);
+    TEST_ASSERT_EQUAL(1, config.power_save);
+    TEST_ASSERT_EQUAL(500755, config.latitude);
+    TEST_ASSERT_EQUAL(144378, config.longitude);
+}
+
+void test_load_rejects_broken_images() {
+    Config config;
+
+    //crc mismatch
+    storeImage(storedFields(), CONFIG_VERSION, sizeof(Config), sizeof(Config)).city_count = 3;
+    TEST_ASSERT_FALSE(configLoad(config, defaults));
+    TEST_ASSERT_EQUAL_STRING("home", config.ssid);
+
+    //unknown versions
+    storeImage(storedFields(), 0, offsetof(Config, timezone), 428);
+    TEST_ASSERT_FALSE(configLoad(config, defaults));
+    storeImage(storedFields(), CONFIG_VERSION + 1, sizeof(Config), sizeof(Config));
+    TEST_ASSERT_FALSE(configLoad(config, defaults));
+
+    //image shorter than its version
+    storeImage(storedFields(), 2, offsetof(Config, timezone), 428);
+    TEST_ASSERT_FALSE(configLoad(config, defaults));
+    TEST_ASSERT_EQUAL_STRING(defaults.timezone, config.timezone);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_values);
+    RUN_TEST(test_parse_invalid_keeps_config);
+    RUN_TEST(test_parse_password_length);
+    RUN_TEST(test_parse_rejects_long_strings);
+    RUN_TEST(test_parse_temp_calibration_range);
+    RUN_TEST(test_load_missing_uses_defaults);
+    RUN_TEST(test_load_current_layout);
+    RUN_TEST(test_migrate_version_1);
+    RUN_TEST(test_migrate_version_3);
+    RUN_TEST(test_load_rejects_broken_images);
+    return UNITY_END();
+}
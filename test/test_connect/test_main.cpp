@@ -0,0 +1,85 @@
+#include <unity.h>
+#include <OneCall.h>
+#include "main.cpp"
+
+//MQTT connect handling of the firmware (main.cpp on the stand-ins): device data and the trace of
+//the previous run go out only over a working connection, weather is requested only when the
+//retained data delivered on subscribing are missing or stale.
+
+static const char *trace_topic = "devices/Device name/trace";
+static const char *request_topic = "weather/requests/Prague";
+
+static void runFor(unsigned long ms) {
+    unsigned long end = millis() + ms;
+    while ((long)(millis() - end) < 0) loop();
+}
+
+static int sentCount(const char *topic) {
+    int count = 0;
+    for (const MqttMessage &message : client.sent) count += message.topic == topic;
+    return count;
+}
+
+static uint32_t utcNow() {
+    return time_client.getEpochTime() - time_offset;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_broker_down_at_boot() {
+    ESP.rtc_memory[32] = TRACE_MAGIC;   //trace of previous run in RTC memory
+    ESP.rtc_memory[33] = 0;
+    client.up = false;
+    client.fail_large = true;           //connection drops while the trace is sent
+    setup();
+    config.city_count = 1;
+    strcpy(config.cities[0], "Prague");
+    client.retained["weather/Prague"] = {0, "weather/Prague", oneCall(utcNow(), ""), true};
+
+    runFor(30000);                      //longer than WEATHER_GRACE and WEATHER_JITTER
+    TEST_ASSERT_EQUAL(0, client.sent.size());
+    TEST_ASSERT_NOT_NULL(tracePrevious());
+
+    client.up = true;
+    runFor(30000);
+    TEST_ASSERT_TRUE(weather[0].dt);
+    TEST_ASSERT_EQUAL(0, sentCount(request_topic));     //retained data came first
+    TEST_ASSERT_EQUAL(1, sentCount("devices/Device name/ip"));
+    TEST_ASSERT_EQUAL(0, sentCount(trace_topic));
+    TEST_ASSERT_NOT_NULL(tracePrevious());
+}
+
+void test_trace_retried_on_next_connect() {
+    client.fail_large = false;
+    client.disconnect();
+    runFor(1000);
+    TEST_ASSERT_EQUAL(1, sentCount(trace_topic));
+    TEST_ASSERT_NULL(tracePrevious());
+    TEST_ASSERT_EQUAL(2, sentCount("devices/Device name/ip"));
+
+    client.disconnect();
+    runFor(1000);
+    TEST_ASSERT_EQUAL(1, sentCount(trace_topic));       //uploaded once
+}
+
+void test_stale_retained_data_requested() {
+    weather[0] = CityWeather();
+    client.retained["weather/Prague"].payload = oneCall(utcNow() - 3 * 3600, "");
+    client.disconnect();
+    unsigned long connected = millis();
+    runFor(30000);
+    TEST_ASSERT_TRUE(weatherStale(0));
+    TEST_ASSERT_EQUAL(1, sentCount(request_topic));
+    for (const MqttMessage &message : client.sent) {
+        if (message.topic == request_topic) TEST_ASSERT_TRUE(message.due - connected >= WEATHER_GRACE);
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_broker_down_at_boot);
+    RUN_TEST(test_trace_retried_on_next_connect);
+    RUN_TEST(test_stale_retained_data_requested);
+    return UNITY_END();
+}
@@ -0,0 +1,92 @@
+#include <unity.h>
+#include <random>
+#include "flush.h"
+
+static Display::Lcd lcd(DISPLAY_ARGS);     //transfers tiles of the backend's layout
+static std::mt19937 rng(3);
+static uint8_t expected[sizeof(lcd.buffer)];
+
+//send whole pending snapshot
+static int flushAll(uint32_t budget_us) {
+    int steps = 0;
+    for (; flushBusy(); steps++) flushStep(lcd, budget_us);
+    return steps;
+}
+
+void setUp() {
+    lcd.byte_us = 23;       //ST7920 on SPI
+    flushInvalidate();
+    flushStart(lcd);
+    flushAll(100000);
+    lcd.sent_bytes = 0;
+}
+void tearDown() {}
+
+void test_sends_only_changed_rows() {
+    TEST_ASSERT_EQUAL(0, flushStart(lcd));
+    TEST_ASSERT_FALSE(flushBusy());
+
+    lcd.drawPixel(5, 3);        //row 0
+    lcd.drawPixel(100, 60);     //row 7
+    int bytes = Display::row_flush ? 2 * 128 : 2 * 8;  //whole rows or the changed tile of each
+    TEST_ASSERT_EQUAL(bytes, flushStart(lcd));
+    flushAll(100000);
+    TEST_ASSERT_EQUAL(bytes, lcd.sent_bytes);
+    TEST_ASSERT_EQUAL_MEMORY(lcd.buffer, lcd.display, sizeof(lcd.buffer));
+}
+
+void test_invalidate_sends_all() {
+    flushInvalidate();
+    TEST_ASSERT_EQUAL(sizeof(lcd.buffer), flushStart(lcd));
+    flushAll(100000);
+    TEST_ASSERT_EQUAL(sizeof(lcd.buffer), lcd.sent_bytes);
+}
+
+void test_budget_spreads_rows() {
+    lcd.drawBox(0, 0, 128, 64);
+    flushStart(lcd);
+    uint64_t start = native_time_us;
+    TEST_ASSERT_EQUAL(8, flushAll(1500));       //row takes 2944 us, at least one per step
+    TEST_ASSERT_EQUAL(8 * 2944, native_time_us - start);
+
+    lcd.clearBuffer();
+    flushStart(lcd);
+    TEST_ASSERT_EQUAL(4, flushAll(6000));       //two rows per step
+}
+
+//drawing while the flush runs is not shown until the next flush
+void test_snapshot_during_flush() {
+    lcd.drawBox(0, 0, 128, 64);
+    memcpy(expected, lcd.buffer, sizeof(expected));
+    flushStart(lcd);
+    flushStep(lcd, 0);
+    lcd.clearBuffer();
+    flushAll(0);
+    TEST_ASSERT_EQUAL_MEMORY(expected, lcd.display, sizeof(expected));
+
+    flushStart(lcd);
+    flushAll(0);
+    TEST_ASSERT_EQUAL_MEMORY(lcd.buffer, lcd.display, sizeof(lcd.buffer));
+}
+
+//new frame started before the previous one was sent replaces its pending rows
+void test_restart_while_busy() {
+    for (int round = 0; round < 2000; round++) {
+        for (int changes = rng() % 6; changes > 0; changes--) lcd.buffer[rng() % sizeof(lcd.buffer)] ^= 1 << (rng() % 8);
+        flushStart(lcd);
+        for (int steps = rng() % 3; steps > 0 && flushBusy(); steps--) flushStep(lcd, 1500);
+    }
+    flushStart(lcd);
+    flushAll(1500);
+    TEST_ASSERT_EQUAL_MEMORY(lcd.buffer, lcd.display, sizeof(lcd.buffer));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sends_only_changed_rows);
+    RUN_TEST(test_invalidate_sends_all);
+    RUN_TEST(test_budget_spreads_rows);
+    RUN_TEST(test_snapshot_during_flush);
+    RUN_TEST(test_restart_while_busy);
+    return UNITY_END();
+}
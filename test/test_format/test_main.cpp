@@ -0,0 +1,84 @@
+#include <unity.h>
+#include <math.h>
+#include "format.h"
+#include "json_stream.h"
+
+static char buf[24];
+
+void setUp() {}
+void tearDown() {}
+
+void test_integers() {
+    TEST_ASSERT_EQUAL_STRING("0", formatInt(buf, 0));
+    TEST_ASSERT_EQUAL_STRING("-12", formatInt(buf, -12));
+    TEST_ASSERT_EQUAL_STRING("2147483647", formatInt(buf, 2147483647L));
+    TEST_ASSERT_EQUAL_STRING("-2147483647", formatInt(buf, -2147483647L));
+}
+
+void test_fixed_matches_printf() {
+    char expected[24];
+    for (long value = -20000; value <= 20000; value += 7) {
+        for (uint8_t decimals = 0; decimals <= 3; decimals++) {
+            long power = decimals == 0 ? 1 : decimals == 1 ? 10 : decimals == 2 ? 100 : 1000;
+            snprintf(expected, sizeof(expected), "%s%ld", value < 0 ? "-" : "", labs(value) / power);
+            if (decimals) snprintf(expected + strlen(expected), sizeof(expected) - strlen(expected), ".%0*ld", decimals, labs(value) % power);
+            TEST_ASSERT_EQUAL_STRING(expected, formatFixed(buf, value, decimals));
+        }
+    }
+    TEST_ASSERT_EQUAL_STRING("-0.5", formatFixed(buf, -5, 1));
+    TEST_ASSERT_EQUAL_STRING("0.05", formatFixed(buf, 5, 2));
+}
+
+void test_round_fixed() {
+    TEST_ASSERT_EQUAL(13, roundFixed(125, 1));     //half away from zero
+    TEST_ASSERT_EQUAL(-13, roundFixed(-125, 1));
+    TEST_ASSERT_EQUAL(12, roundFixed(124, 1));
+    TEST_ASSERT_EQUAL(-12, roundFixed(-124, 1));
+    TEST_ASSERT_EQUAL(0, roundFixed(-4, 1));
+    TEST_ASSERT_EQUAL(1, roundFixed(1499, 3));
+    TEST_ASSERT_EQUAL(7, roundFixed(7, 0));
+}
+
+//temperature shown from fixed point matches the former float path (atof() - 273.15 in float,
+//rounded to 0.1) for every 0.01 K value from 200 K to 340 K
+void test_kelvin_matches_float_path() {
+    char value[16], fixed[16], floating[16];
+    for (long centi = 20000; centi <= 34000; centi++) {
+        snprintf(value, sizeof(value), "%ld.%02ld", centi / 100, centi % 100);
+        float temp = atof(value) - 273.15;
+        formatTemperature(floating, lround(temp * 10));
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(floating, formatTemperature(fixed, kelvinToDeci(parseFixed(value, 2))), value);
+    }
+    TEST_ASSERT_EQUAL(233, kelvinToDeci(29642));
+    TEST_ASSERT_EQUAL(-2733, kelvinToDeci(-10));    //rounded away from zero
+}
+
+void test_units() {
+    TEST_ASSERT_EQUAL_STRING("-12.5\xb0", formatTemperature(buf, -125));
+    TEST_ASSERT_EQUAL_STRING("0.0\xb0", formatTemperature(buf, 0));
+    TEST_ASSERT_EQUAL_STRING("1.013bar", formatPressure(buf, 1013));
+    TEST_ASSERT_EQUAL_STRING("0.987bar", formatPressure(buf, 987));
+    TEST_ASSERT_EQUAL_STRING("3.4m/s", formatSpeed(buf, 34));
+    TEST_ASSERT_EQUAL_STRING("65%", formatPercent(buf, 65));
+    TEST_ASSERT_EQUAL_STRING("100%", formatPercent(buf, 100));
+}
+
+void test_clock_and_date() {
+    TEST_ASSERT_EQUAL_STRING("05", formatTwoDigits(buf, 5));
+    TEST_ASSERT_EQUAL_STRING("59", formatTwoDigits(buf, 59));
+    TEST_ASSERT_EQUAL_STRING("00:00:00", formatClock(buf, 0, 0, 0));
+    TEST_ASSERT_EQUAL_STRING("23:07:09", formatClock(buf, 23, 7, 9));
+    TEST_ASSERT_EQUAL_STRING("01.02.2036", formatDate(buf, 1, 2, 2036));
+    TEST_ASSERT_EQUAL_STRING("31.12.1999", formatDate(buf, 31, 12, 1999));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_integers);
+    RUN_TEST(test_fixed_matches_printf);
+    RUN_TEST(test_round_fixed);
+    RUN_TEST(test_kelvin_matches_float_path);
+    RUN_TEST(test_units);
+    RUN_TEST(test_clock_and_date);
+    return UNITY_END();
+}
@@ -0,0 +1,90 @@
+#include <unity.h>
+#include "display.h"
+#include "glyph_cache.h"
+
+static U8G2 lcd;
+static uint8_t expected[sizeof(lcd.buffer)];
+
+//background both drawings are ORed onto
+static void background() {
+    lcd.clearBuffer();
+    lcd.setDrawColor(1);
+    lcd.drawBox(0, 30, 128, 4);
+    lcd.drawLine(0, 0, 127, 63);
+}
+
+//draw text by u8g2 and from the cache at the same place, buffers must be equal
+static void compare(int x, int y, const char *text) {
+    background();
+    lcd.setFont(u8g2_font_profont22_tn);
+    lcd.drawStr(x, y, text);
+    memcpy(expected, lcd.buffer, sizeof(expected));
+
+    background();
+    TEST_ASSERT_TRUE(glyphCacheDraw(lcd, x, y, text));
+    TEST_ASSERT_EQUAL_MEMORY(expected, lcd.buffer, sizeof(expected));
+}
+
+void setUp() {
+    if (Display::layout != DISPLAY_HORIZONTAL) return;
+    TEST_ASSERT_TRUE(glyphCacheBegin(lcd, u8g2_font_profont22_tn, "0123456789:"));
+}
+void tearDown() {}
+
+void test_begin_clears_buffer() {
+    for (uint8_t byte : lcd.buffer) TEST_ASSERT_EQUAL(0, byte);
+}
+
+void test_width() {
+    lcd.setFont(u8g2_font_profont22_tn);
+    TEST_ASSERT_EQUAL(lcd.getStrWidth("12:34:56"), glyphCacheWidth("12:34:56"));
+    TEST_ASSERT_EQUAL(0, glyphCacheWidth(""));
+}
+
+void test_draw_matches_u8g2() {
+    compare(20, 44, "12:34:56");
+    compare(0, 14, "0987654321");
+    for (int x = -3; x < 11; x++) compare(x, 44, "8:8");     //every bit offset
+}
+
+void test_draw_clipped() {
+    compare(-20, 44, "12:34");
+    compare(100, 44, "12:34");
+    compare(40, 5, "59");       //above the top
+    compare(40, 70, "59");      //below the bottom
+}
+
+void test_uncached_char_draws_nothing() {
+    background();
+    memcpy(expected, lcd.buffer, sizeof(expected));
+    TEST_ASSERT_FALSE(glyphCacheDraw(lcd, 10, 44, "12.5"));
+    TEST_ASSERT_EQUAL_MEMORY(expected, lcd.buffer, sizeof(expected));
+}
+
+void test_font_too_large() {
+    static const uint8_t wide_font[] = {20, 14, 0};
+    TEST_ASSERT_FALSE(glyphCacheBegin(lcd, wide_font, "0123456789"));
+    TEST_ASSERT_FALSE(glyphCacheDraw(lcd, 0, 20, "1"));
+    TEST_ASSERT_FALSE(glyphCacheBegin(lcd, u8g2_font_profont22_tn, "0123456789:.-+ "));  //too many chars
+}
+
+//vertical layouts (SSD1306, SH1106) are not cached, text is drawn by u8g2
+void test_vertical_layout_not_cached() {
+    TEST_ASSERT_FALSE(glyphCacheBegin(lcd, u8g2_font_profont22_tn, "0123456789:"));
+    TEST_ASSERT_FALSE(glyphCacheDraw(lcd, 20, 44, "12:34:56"));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    if (Display::layout != DISPLAY_HORIZONTAL) {
+        RUN_TEST(test_vertical_layout_not_cached);
+        return UNITY_END();
+    }
+    RUN_TEST(test_begin_clears_buffer);
+    RUN_TEST(test_width);
+    RUN_TEST(test_draw_matches_u8g2);
+    RUN_TEST(test_draw_clipped);
+    RUN_TEST(test_uncached_char_draws_nothing);
+    RUN_TEST(test_font_too_large);
+    return UNITY_END();
+}
@@ -0,0 +1,96 @@
+#include <unity.h>
+#include <NativeHeap.h>
+#include <string>
+#include <vector>
+#include "health.h"
+
+static char report[1024];
+
+//line of the report (0 = reset line)
+static std::string reportLine(int index) {
+    std::string text = report;
+    size_t start = 0;
+    for (int i = 0; i < index; i++) start = text.find('\n', start) + 1;
+    return text.substr(start, text.find('\n', start) - start);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_allocator_metrics() {
+    std::vector<char *> blocks;
+    blocks.reserve(64);
+    uint32_t baseline = ESP.getFreeHeap();
+    TEST_ASSERT_EQUAL(0, ESP.getHeapFragmentation());
+
+    //64 blocks of 200 bytes, every other one freed leaves holes the size of one allocation
+    for (int i = 0; i < 64; i++) blocks.push_back(new char[200]);
+    TEST_ASSERT_EQUAL(baseline - 64 * 208, ESP.getFreeHeap());     //header and 8 byte blocks
+    for (int i = 0; i < 64; i += 2) delete[] blocks[i];
+
+    uint32_t free_heap = ESP.getFreeHeap();
+    TEST_ASSERT_EQUAL(baseline - 32 * 208, free_heap);
+    TEST_ASSERT_TRUE(ESP.getMaxFreeBlockSize() < free_heap);
+    TEST_ASSERT_TRUE(ESP.getHeapFragmentation() > 10);
+
+    //holes are reused by allocations that fit them
+    char *reused = new char[150];
+    TEST_ASSERT_TRUE(reused > blocks[0] - 1 && reused < blocks[63]);
+    delete[] reused;
+
+    for (int i = 1; i < 64; i += 2) delete[] blocks[i];
+    TEST_ASSERT_EQUAL(baseline, ESP.getFreeHeap());
+    TEST_ASSERT_EQUAL(0, ESP.getHeapFragmentation());
+    TEST_ASSERT_TRUE(native_heap.lowestFreeHeap() <= baseline - 64 * 208);
+}
+
+void test_exhaustion() {
+    std::vector<char *> blocks;
+    blocks.reserve(100);
+    unsigned long failures = native_heap.failures;
+    try {
+        for (int i = 0; i < 100; i++) blocks.push_back(new char[1000]);
+        TEST_FAIL_MESSAGE("heap did not run out");
+    }
+    catch (const std::bad_alloc &) {
+    }
+    TEST_ASSERT_EQUAL(failures + 1, native_heap.failures);
+    TEST_ASSERT_TRUE(ESP.getMaxFreeBlockSize() < 1000);
+    TEST_ASSERT_NULL(new (std::nothrow) char[1000]);
+    for (char *block : blocks) delete[] block;
+}
+
+void test_report() {
+    ESP.free_cont_stack = 2500;
+    healthSample();
+
+    //fragmented heap between samples
+    std::vector<char *> blocks;
+    blocks.reserve(40);
+    for (int i = 0; i < 40; i++) blocks.push_back(new char[300]);
+    for (int i = 0; i < 40; i += 2) delete[] blocks[i];
+    ESP.free_cont_stack = 1800;
+    delay(60000);
+    healthSample();
+    uint32_t free_heap = ESP.getFreeHeap();
+    uint32_t max_block = ESP.getMaxFreeBlockSize();
+    uint8_t fragmentation = ESP.getHeapFragmentation();
+    for (int i = 1; i < 40; i += 2) delete[] blocks[i];
+
+    healthReport(report, sizeof(report));
+    TEST_ASSERT_EQUAL_STRING("reset External System", reportLine(0).c_str());
+    char expected[64];
+    snprintf(expected, sizeof(expected), "min %u %u 1800", (unsigned)free_heap, (unsigned)max_block);
+    TEST_ASSERT_EQUAL_STRING(expected, reportLine(1).c_str());
+    snprintf(expected, sizeof(expected), "60 %u %u %u 1800", (unsigned)free_heap, (unsigned)max_block, fragmentation);
+    TEST_ASSERT_EQUAL_STRING(expected, reportLine(3).c_str());
+    TEST_ASSERT_EQUAL_STRING("", reportLine(4).c_str());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_allocator_metrics);
+    RUN_TEST(test_exhaustion);
+    RUN_TEST(test_report);
+    return UNITY_END();
+}
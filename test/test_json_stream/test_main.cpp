@@ -0,0 +1,205 @@
+#include <unity.h>
+#include <string>
+#include "json_stream.h"
+
+//values reported by the parser as "pattern=value" (first matching pattern of the list)
+struct Recorder {
+    const char *const *patterns;
+    std::string values;
+};
+
+static void record(JsonStream &json, const char *value, void *ctx) {
+    Recorder &recorder = *(Recorder *)ctx;
+    const char *name = "?";
+    for (const char *const *pattern = recorder.patterns; *pattern; pattern++) {
+        if (json.match(*pattern)) {
+            name = *pattern;
+            break;
+        }
+    }
+    recorder.values += std::string(name) + (json.isString() ? "=\"" : "=") + value + (json.isString() ? "\" " : " ");
+}
+
+static std::string parse(const char *text, const char *const *patterns, bool *done = NULL) {
+    Recorder recorder = {patterns, ""};
+    JsonStream json(record, &recorder);
+    json.feed((const byte *)text, strlen(text));
+    if (done) *done = json.done();
+    return recorder.values;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_paths_and_values() {
+    static const char *const patterns[] = {"current.temp", "daily.#.temp.day", "hourly.#", "flag", "none", NULL};
+    bool done = false;
+    std::string values = parse(
+        "{\"current\": {\"temp\": 271.5, \"weather\": [{\"icon\": \"04d\"}]},\n"
+        " \"daily\": [{\"temp\": {\"day\": 280}}, {\"temp\": {\"day\": -3.5e1}}],\n"
+        " \"hourly\": [1, 2], \"flag\": true, \"none\": null}", patterns, &done);
+    TEST_ASSERT_TRUE(done);
+    TEST_ASSERT_EQUAL_STRING("current.temp=271.5 ?=\"04d\" daily.#.temp.day=280 daily.#.temp.day=-3.5e1 "
+                             "hourly.#=1 hourly.#=2 flag=true none=null ", values.c_str());
+}
+
+void test_array_index() {
+    struct Indexes {
+        std::string seen;
+    } indexes;
+    JsonStream json([](JsonStream &json, const char *value, void *ctx) {
+        if (json.match("a.#.b.#")) ((Indexes *)ctx)->seen += std::to_string(json.index(1)) + "/" + std::to_string(json.index(3)) + " ";
+        TEST_ASSERT_EQUAL(-1, json.index(0));   //object level
+    }, &indexes);
+    const char *text = "{\"a\": [{\"b\": [1, 2]}, {\"b\": []}, {\"b\": [3]}]}";
+    json.feed((const byte *)text, strlen(text));
+    TEST_ASSERT_TRUE(json.done());
+    TEST_ASSERT_EQUAL_STRING("0/0 0/1 2/0 ", indexes.seen.c_str());
+}
+
+void test_match_exact_index() {
+    static const char *const patterns[] = {"list.1", NULL};
+    TEST_ASSERT_EQUAL_STRING("?=10 list.1=11 ?=12 ", parse("{\"list\": [10, 11, 12]}", patterns).c_str());
+}
+
+void test_chunks() {
+    static const char *const patterns[] = {"a", "b.#", NULL};
+    const char *text = "{\"a\": \"x\\\"y\", \"b\": [1.25, false]}";
+    std::string whole = parse(text, patterns);
+
+    //feed byte by byte, value spans many calls
+    Recorder recorder = {patterns, ""};
+    JsonStream json(record, &recorder);
+    for (const char *c = text; *c; c++) json.feed(*c);
+    TEST_ASSERT_TRUE(json.done());
+    TEST_ASSERT_EQUAL_STRING(whole.c_str(), recorder.values.c_str());
+    TEST_ASSERT_EQUAL_STRING("a=\"x\"y\" b.#=1.25 b.#=false ", whole.c_str());
+}
+
+void test_escapes_and_unicode() {
+    static const char *const patterns[] = {"s", NULL};
+    TEST_ASSERT_EQUAL_STRING("s=\"a\nb\tc/\\\" ", parse("{\"s\": \"a\\nb\\tc\\/\\\\\"}", patterns).c_str());
+    //\u escapes become utf-8, surrogates (not supported) become '?'
+    TEST_ASSERT_EQUAL_STRING("s=\"A\xC4\x8D\xE2\x82\xAC?\" ", parse("{\"s\": \"\\u0041\\u010d\\u20AC\\ud83d\"}", patterns).c_str());
+    //raw utf-8 is passed through
+    TEST_ASSERT_EQUAL_STRING("s=\"P\xC5\x99\xC3\xAD" "bram\" ", parse("{\"s\": \"P\xC5\x99\xC3\xAD" "bram\"}", patterns).c_str());
+}
+
+void test_truncation_keeps_whole_characters() {
+    static const char *const patterns[] = {"s", NULL};
+    std::string text = "{\"s\": \"";
+    for (int i = 0; i < JSON_VALUE_LEN - 2; i++) text += 'x';
+    text += "\xC4\x8D\"}";     //2-byte character does not fit after JSON_VALUE_LEN - 2 bytes
+    std::string values = parse(text.c_str(), patterns);
+    TEST_ASSERT_EQUAL(JSON_VALUE_LEN - 2, values.size() - strlen("s=\"\" "));
+    TEST_ASSERT_EQUAL('x', values[values.size() - 3]);
+
+    //long numbers are cut too
+    static const char *const number[] = {"n", NULL};
+    std::string digits = "{\"n\": ";
+    for (int i = 0; i < JSON_VALUE_LEN + 10; i++) digits += '1';
+    bool done = false;
+    values = parse((digits + "}").c_str(), number, &done);
+    TEST_ASSERT_TRUE(done);
+    TEST_ASSERT_EQUAL(JSON_VALUE_LEN - 1, values.size() - strlen("n= "));
+}
+
+void test_long_keys_are_truncated() {
+    std::string key = std::string("abcdefghijklmnopqrstuvwxyz").substr(0, JSON_KEY_LEN - 1);
+    const char *const patterns[] = {key.c_str(), NULL};
+    TEST_ASSERT_EQUAL_STRING((key + "=1 ").c_str(), parse("{\"abcdefghijklmnopqrstuvwxyz\": 1}", patterns).c_str());
+}
+
+void test_deep_values_are_skipped() {
+    static const char *const patterns[] = {"a", NULL};
+    bool done = false;
+    std::string values = parse("{\"deep\": [[[[[[[1, 2]]]]]]], \"a\": 3}", patterns, &done);
+    TEST_ASSERT_TRUE(done);
+    TEST_ASSERT_EQUAL_STRING("a=3 ", values.c_str());
+}
+
+void test_invalid_documents() {
+    static const char *const invalid[] = {
+        "{\"a\": 1]", "[1, 2}", "{\"a\" 1}", "{a: 1}", "[1,, 2]", "{\"a\": x}", "{\"s\": \"\\uzzzz\"}", NULL
+    };
+    for (const char *const *text = invalid; *text; text++) {
+        JsonStream json([](JsonStream &, const char *, void *) {});
+        json.feed((const byte *)*text, strlen(*text));
+        TEST_ASSERT_TRUE_MESSAGE(json.failed(), *text);
+        TEST_ASSERT_FALSE(json.done());
+    }
+
+    //incomplete document is neither done nor failed
+    JsonStream json([](JsonStream &, const char *, void *) {});
+    json.feed((const byte *)"{\"a\": [1", 8);
+    TEST_ASSERT_FALSE(json.done());
+    TEST_ASSERT_FALSE(json.failed());
+}
+
+void test_reset() {
+    static const char *const patterns[] = {"a", NULL};
+    Recorder recorder = {patterns, ""};
+    JsonStream json(record, &recorder);
+    json.feed((const byte *)"{\"a\": [", 7);
+    json.reset();
+    json.feed((const byte *)"{\"a\": 5}", 8);
+    TEST_ASSERT_TRUE(json.done());
+    TEST_ASSERT_EQUAL_STRING("a=5 ", recorder.values.c_str());
+}
+
+void test_top_level_scalar() {
+    static const char *const patterns[] = {"", NULL};
+    bool done = false;
+    TEST_ASSERT_EQUAL_STRING("=42 ", parse("42 ", patterns, &done).c_str());
+    TEST_ASSERT_TRUE(done);
+}
+
+void test_parse_fixed() {
+    TEST_ASSERT_EQUAL(1235, parseFixed("12.345", 2));
+    TEST_ASSERT_EQUAL(-1235, parseFixed("-12.345", 2));
+    TEST_ASSERT_EQUAL(2715, parseFixed("271.5", 1));
+    TEST_ASSERT_EQUAL(2720, parseFixed("272", 1));
+    TEST_ASSERT_EQUAL(3, parseFixed("2.5", 0));        //half away from zero
+    TEST_ASSERT_EQUAL(-3, parseFixed("-2.5", 0));
+    TEST_ASSERT_EQUAL(0, parseFixed("0.04", 1));
+    TEST_ASSERT_EQUAL(1, parseFixed("0.05", 1));
+    TEST_ASSERT_EQUAL(15, parseFixed("+1.5", 1));
+    TEST_ASSERT_EQUAL(-350, parseFixed("-3.5e1", 1));
+    TEST_ASSERT_EQUAL(12, parseFixed("1.2E-2", 3));
+    TEST_ASSERT_EQUAL(0, parseFixed("1e-20", 2));
+    TEST_ASSERT_EQUAL(0, parseFixed("", 2));
+    TEST_ASSERT_EQUAL(0, parseFixed("null", 2));
+    TEST_ASSERT_EQUAL(1000, parseFixed("1000.0000000000001", 0));   //only first 9 digits count
+    TEST_ASSERT_EQUAL(2147483647L, parseFixed("1e12", 2));          //saturates
+    TEST_ASSERT_EQUAL(1792000000L, parseFixed("1792000000", 0));
+}
+
+//huge exponents saturate at once (no loop over the exponent, no atoi overflow)
+void test_parse_fixed_exponent_bounds() {
+    TEST_ASSERT_EQUAL(2147483647L, parseFixed("1e999999999", 2));
+    TEST_ASSERT_EQUAL(-2147483647L, parseFixed("-1e999999999", 2));
+    TEST_ASSERT_EQUAL(2147483647L, parseFixed("1.5e+99999999999999999999", 0));
+    TEST_ASSERT_EQUAL(0, parseFixed("0e999999999", 2));
+    TEST_ASSERT_EQUAL(0, parseFixed("1e-999999999", 2));
+    TEST_ASSERT_EQUAL(0, parseFixed("-7e-99999999999999999999", 2));
+    TEST_ASSERT_EQUAL(1, parseFixed("5e-1", 0));
+    TEST_ASSERT_EQUAL(120, parseFixed("1.2e", 2));     //exponent without digits
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_paths_and_values);
+    RUN_TEST(test_array_index);
+    RUN_TEST(test_match_exact_index);
+    RUN_TEST(test_chunks);
+    RUN_TEST(test_escapes_and_unicode);
+    RUN_TEST(test_truncation_keeps_whole_characters);
+    RUN_TEST(test_long_keys_are_truncated);
+    RUN_TEST(test_deep_values_are_skipped);
+    RUN_TEST(test_invalid_documents);
+    RUN_TEST(test_reset);
+    RUN_TEST(test_top_level_scalar);
+    RUN_TEST(test_parse_fixed);
+    RUN_TEST(test_parse_fixed_exponent_bounds);
+    return UNITY_END();
+}
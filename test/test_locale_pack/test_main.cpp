@@ -0,0 +1,78 @@
+#include <unity.h>
+#include <U8g2lib.h>
+#include "locale_pack.h"
+
+//Texts of the locale pack selected by LOCALE (native envs build each pack): stored widths match
+//the drawn UTF-8 text, so names with diacritics are centered like ASCII ones.
+
+static U8G2 lcd;
+static char buf[LOCALE_TEXT_LEN];
+
+//UTF-8 text drawn in 6x12 is centered on the display
+static void assertCentered(const char *text, int width) {
+    lcd.setFont(u8g2_font_6x12_te);
+    TEST_ASSERT_EQUAL_MESSAGE(lcd.drawUTF8(0, 12, text), width, text);
+    TEST_ASSERT_TRUE_MESSAGE(width <= LOCALE_MAX_WIDTH, text);
+    int x = U8G2::width / 2 - width / 2;     //as drawCenteredString()
+    TEST_ASSERT_INT_WITHIN_MESSAGE(1, U8G2::width - x - width, x, text);   //same margin on both sides
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_string_width_counts_characters() {
+    TEST_ASSERT_EQUAL(0, stringWidth("", 6));
+    TEST_ASSERT_EQUAL(18, stringWidth("100", 6));
+    TEST_ASSERT_EQUAL(42, stringWidth("Čtvrtek", 6));            //2 byte character
+    TEST_ASSERT_EQUAL(120, stringWidth("Aktualisierung läuft", 6));
+    TEST_ASSERT_EQUAL(10, stringWidth("€1", 5));                //3 byte character
+    TEST_ASSERT_EQUAL(5, stringWidth("\xF0\x9F\x8C\xA7", 5));   //4 byte character
+}
+
+void test_string_width_matches_compile_time() {
+    static constexpr char texts[][24] = {"Neděle", "Připojování k WiFi", "Aktualisierung läuft", "12:45:07", "100"};
+    static constexpr int widths[] = {
+        textWidth(texts[0], 6), textWidth(texts[1], 6), textWidth(texts[2], 6), textWidth(texts[3], 11), textWidth(texts[4], 6)
+    };
+    for (unsigned i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(widths[i], stringWidth(texts[i], i == 3 ? 11 : 6), texts[i]);
+    }
+}
+
+void test_weekdays_centered() {
+    for (uint8_t day = 0; day < 14; day++) {
+        int width = localeWeekday(buf, day);
+        assertCentered(buf, width);
+        TEST_ASSERT_EQUAL(stringWidth(buf, FONT_6X12_ADVANCE), width);
+
+        char other[LOCALE_TEXT_LEN];
+        localeWeekday(other, day % 7);
+        TEST_ASSERT_EQUAL_STRING(other, buf);
+    }
+}
+
+void test_labels_centered() {
+    for (uint8_t label = 0; label < LOCALE_LABELS; label++) {
+        int width = localeLabel(buf, (LocaleLabel)label);
+        assertCentered(buf, width);
+        TEST_ASSERT_TRUE(strlen(buf) < LOCALE_TEXT_LEN);
+    }
+}
+
+void test_weekdays_short_fit_column() {
+    for (uint8_t day = 0; day < 7; day++) {
+        localeWeekdayShort(buf, day);
+        TEST_ASSERT_TRUE_MESSAGE(stringWidth(buf, FONT_PROFONT10_ADVANCE) <= 15, buf);
+        for (const char *c = buf; *c; c++) TEST_ASSERT_TRUE_MESSAGE((uint8_t)*c < 0xC4, buf);   //Latin-1 font
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_string_width_counts_characters);
+    RUN_TEST(test_string_width_matches_compile_time);
+    RUN_TEST(test_weekdays_centered);
+    RUN_TEST(test_labels_centered);
+    RUN_TEST(test_weekdays_short_fit_column);
+    return UNITY_END();
+}
@@ -0,0 +1,198 @@
+#include <unity.h>
+#include <FakeNtp.h>
+#include "NTPClient.h"
+
+static FakeNtpUdp udp;
+static const char *const names[] = {"dead", "slow", "fast"};
+
+//reference UTC (s) at current virtual time
+static uint64_t referenceEpoch() {
+    return (native_ntp_epoch_ms + millis()) / 1000;
+}
+
+//run client like the main loop does for given virtual time (s)
+static int runLoop(NTPClient &ntp, unsigned long seconds) {
+    int polls = 0;
+    for (unsigned long end = millis() + seconds * 1000; millis() < end; delay(1000)) {
+        if (ntp.isUpdateDue()) {
+            ntp.forceUpdate();
+            polls++;
+        }
+    }
+    return polls;
+}
+
+void setUp() {
+    native_time_us = 0;
+    native_ntp_epoch_ms = 1700000000000ULL;
+    udp.servers.clear();
+    udp.forge = nullptr;
+}
+void tearDown() {}
+
+void test_sync() {
+    udp.servers["fast"].rtt = 40;
+    NTPClient ntp(udp, "fast");
+    ntp.begin();
+    TEST_ASSERT_TRUE(ntp.isUpdateDue());
+    TEST_ASSERT_TRUE(ntp.forceUpdate());
+    TEST_ASSERT_TRUE(ntp.isTimeSet());
+    TEST_ASSERT_EQUAL(referenceEpoch(), ntp.getEpochTime64());
+    TEST_ASSERT_FALSE(ntp.isUpdateDue());
+    TEST_ASSERT_EQUAL(60000 - 40, ntp.getUpdateDueIn());
+    TEST_ASSERT_EQUAL(40, ntp.getServer().delay);
+}
+
+void test_failed_updates_back_off() {
+    udp.servers["fast"].up = false;
+    NTPClient ntp(udp, "fast");
+    ntp.begin();
+
+    //retry after 10 s, doubling up to the update interval, also before the time was ever set
+    static const unsigned long expected[] = {10000, 20000, 40000, 60000, 60000};
+    for (unsigned long interval : expected) {
+        TEST_ASSERT_TRUE(ntp.isUpdateDue());
+        unsigned long attempt = millis();
+        TEST_ASSERT_FALSE(ntp.forceUpdate());
+        TEST_ASSERT_FALSE(ntp.isTimeSet());
+        TEST_ASSERT_FALSE(ntp.isUpdateDue());
+        TEST_ASSERT_EQUAL(interval, ntp.getUpdateDueIn() + (millis() - attempt));
+        delay(ntp.getUpdateDueIn());
+    }
+
+    //server is back, normal interval again
+    udp.servers["fast"].up = true;
+    TEST_ASSERT_TRUE(ntp.isUpdateDue());
+    TEST_ASSERT_TRUE(ntp.forceUpdate());
+    TEST_ASSERT_EQUAL(60000, ntp.getUpdateInterval());
+    TEST_ASSERT_EQUAL(60000 - 20, ntp.getUpdateDueIn());
+}
+
+void test_unreachable_network_does_not_block_loop() {
+    for (const char *name : names) udp.servers[name].up = false;
+    NTPClient ntp(udp, names, 3);
+    ntp.begin();
+
+    //10 minutes: attempts at 0, 10, 30, 70 s and then every minute, 3 servers (1 s each) per attempt
+    TEST_ASSERT_EQUAL(12, runLoop(ntp, 600));
+    TEST_ASSERT_EQUAL(12, udp.servers["dead"].requests);
+}
+
+void test_failover_to_best_server() {
+    udp.servers["dead"].up = false;
+    udp.servers["slow"].rtt = 80;
+    udp.servers["fast"].rtt = 20;
+    NTPClient ntp(udp, names, 3);
+    ntp.begin();
+
+    runLoop(ntp, 86400);
+    TEST_ASSERT_EQUAL_STRING("fast", ntp.getServer().name);
+    TEST_ASSERT_EQUAL(0, ntp.getServer(0).reach);
+    TEST_ASSERT_EQUAL(NTP_MAX_INTERVAL, ntp.getUpdateInterval());   //stable clock polls rarely
+    TEST_ASSERT_UINT64_WITHIN(1, referenceEpoch(), ntp.getEpochTime64());
+}
+
+void test_pool_change_resets_backoff() {
+    udp.servers["dead"].up = false;
+    NTPClient ntp(udp, "dead");
+    ntp.begin();
+    TEST_ASSERT_FALSE(ntp.forceUpdate());
+    TEST_ASSERT_FALSE(ntp.isUpdateDue());
+
+    ntp.setPoolServers(names + 2, 1);
+    TEST_ASSERT_TRUE(ntp.isUpdateDue());    //time was never set, try the new server now
+    TEST_ASSERT_TRUE(ntp.update());
+    TEST_ASSERT_TRUE(ntp.isTimeSet());
+}
+
+void test_ntp_to_epoch() {
+    TEST_ASSERT_EQUAL(0, NTPClient::ntpToEpoch(2208988800UL));                  //1.1.1970
+    TEST_ASSERT_EQUAL(1700000000, NTPClient::ntpToEpoch(3908988800UL));
+    TEST_ASSERT_EQUAL(2085978495, NTPClient::ntpToEpoch(0xFFFFFFFFUL));         //7.2.2036 06:28:15, last second of era 0
+    TEST_ASSERT_EQUAL(2085978496ULL, NTPClient::ntpToEpoch(0));                 //first second of era 1
+    TEST_ASSERT_EQUAL(2085978496ULL + 0x7FFFFFFF, NTPClient::ntpToEpoch(NTP_ERA_PIVOT - 1));   //2104, last one mapped to era 1
+}
+
+void test_sync_across_era_rollover() {
+    native_ntp_epoch_ms = (2085978496ULL - 30) * 1000;
+    NTPClient ntp(udp, "fast");
+    ntp.begin();
+    TEST_ASSERT_TRUE(ntp.forceUpdate());
+    TEST_ASSERT_EQUAL(referenceEpoch(), ntp.getEpochTime64());
+
+    //next poll gets era 1 timestamps (seconds counted from 0 again)
+    delay(60000);
+    TEST_ASSERT_TRUE(ntp.update());
+    TEST_ASSERT_TRUE(referenceEpoch() > 2085978496ULL);
+    TEST_ASSERT_EQUAL(referenceEpoch(), ntp.getEpochTime64());
+    TEST_ASSERT_EQUAL((unsigned long)referenceEpoch(), ntp.getEpochTime());    //32 bit value is valid until 2106
+    TEST_ASSERT_EQUAL(120000, ntp.getUpdateInterval());     //clock was stable, no step detected at the rollover
+}
+
+void test_invalid_answers_are_rejected() {
+    //each forgery breaks the only answer: update fails, time stays unset
+    static const std::function<void(std::vector<uint8_t> &)> forgeries[] = {
+        [](std::vector<uint8_t> &p) { p[30] ^= 1; },                    //originate does not echo our request
+        [](std::vector<uint8_t> &p) { p[0] |= 0xC0; },                  //leap indicator unsynchronized
+        [](std::vector<uint8_t> &p) { p[0] = 0x1C; },                   //version 3
+        [](std::vector<uint8_t> &p) { p[0] = 0x23; },                   //mode client
+        [](std::vector<uint8_t> &p) { p[1] = 0; },                      //stratum 0 (kiss of death)
+        [](std::vector<uint8_t> &p) { p[1] = 16; },                     //stratum 16 (unsynchronized)
+        [](std::vector<uint8_t> &p) { p[16] = 0; },                     //no reference timestamp
+        [](std::vector<uint8_t> &p) { memset(&p[40], 0, 4); },          //no transmit timestamp
+        [](std::vector<uint8_t> &p) { p.resize(40); },                  //short datagram
+    };
+    for (const std::function<void(std::vector<uint8_t> &)> &forgery : forgeries) {
+        udp.forge = [&](std::vector<std::vector<uint8_t>> &packets) { forgery(packets[0]); };
+        NTPClient ntp(udp, "fast");
+        ntp.begin();
+        TEST_ASSERT_FALSE(ntp.forceUpdate());
+        TEST_ASSERT_FALSE(ntp.isTimeSet());
+    }
+
+    //only the reference timestamp byte 23 set is still a valid reference
+    udp.forge = [](std::vector<std::vector<uint8_t>> &packets) {
+        packets[0][16] = 0;
+        packets[0][23] = 1;
+    };
+    NTPClient ntp(udp, "fast");
+    ntp.begin();
+    TEST_ASSERT_TRUE(ntp.forceUpdate());
+}
+
+void test_forged_answers_around_real_one() {
+    //spoofed answer (one hour off) arrives first, a duplicate with another time after the real one
+    udp.forge = [](std::vector<std::vector<uint8_t>> &packets) {
+        std::vector<uint8_t> spoofed = packets[0];
+        spoofed[26] ^= 0x40;
+        spoofed[41] += 0x0E;
+        std::vector<uint8_t> duplicate = packets[0];
+        duplicate[42] += 1;
+        packets.insert(packets.begin(), spoofed);
+        packets.push_back(duplicate);
+    };
+    NTPClient ntp(udp, "fast");
+    ntp.begin();
+    TEST_ASSERT_TRUE(ntp.forceUpdate());
+    TEST_ASSERT_EQUAL(referenceEpoch(), ntp.getEpochTime64());
+
+    //late duplicate of the previous request is dropped by the next one
+    delay(60000);
+    udp.forge = nullptr;
+    TEST_ASSERT_TRUE(ntp.update());
+    TEST_ASSERT_EQUAL(referenceEpoch(), ntp.getEpochTime64());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sync);
+    RUN_TEST(test_failed_updates_back_off);
+    RUN_TEST(test_unreachable_network_does_not_block_loop);
+    RUN_TEST(test_failover_to_best_server);
+    RUN_TEST(test_pool_change_resets_backoff);
+    RUN_TEST(test_ntp_to_epoch);
+    RUN_TEST(test_sync_across_era_rollover);
+    RUN_TEST(test_invalid_answers_are_rejected);
+    RUN_TEST(test_forged_answers_around_real_one);
+    return UNITY_END();
+}
@@ -0,0 +1,77 @@
+#include <unity.h>
+#include <string>
+#include "format.h"
+#include "health.h"
+#include "power.h"
+#include "profiler.h"
+#include "render.h"
+
+typedef size_t (*Report)(char *buf, size_t len);
+static const Report reports[] = {profileReport, healthReport, renderReport, powerReport};
+
+void setUp() {
+    profileBegin();
+    for (int i = 0; i < 16; i++) healthSample();
+}
+void tearDown() {}
+
+void test_clamp_length() {
+    TEST_ASSERT_EQUAL(5, clampLength(5, 10));
+    TEST_ASSERT_EQUAL(9, clampLength(10, 10));
+    TEST_ASSERT_EQUAL(9, clampLength(300, 10));
+    TEST_ASSERT_EQUAL(0, clampLength(0, 0));
+    TEST_ASSERT_EQUAL(0, clampLength(12, 0));
+}
+
+void test_append_text() {
+    char buf[8] = "abc";
+    TEST_ASSERT_EQUAL(4, appendText(buf, sizeof(buf), 3, "\n"));
+    TEST_ASSERT_EQUAL_STRING("abc\n", buf);
+    TEST_ASSERT_EQUAL(7, appendText(buf, sizeof(buf), 4, "defgh"));     //cut
+    TEST_ASSERT_EQUAL_STRING("abc\ndef", buf);
+    TEST_ASSERT_EQUAL(7, appendText(buf, sizeof(buf), 7, "x"));         //full
+    TEST_ASSERT_EQUAL(0, appendText(buf, 0, 0, "x"));
+    TEST_ASSERT_EQUAL_STRING("abc\ndef", buf);
+}
+
+void test_reports_fit_any_buffer() {
+    for (Report report : reports) {
+        char buf[600];
+        for (size_t len = 0; len <= sizeof(buf) - 1; len++) {
+            memset(buf, '#', sizeof(buf));
+            size_t used = report(buf, len);
+            if (len == 0) {
+                TEST_ASSERT_EQUAL(0, used);
+                TEST_ASSERT_EQUAL('#', buf[0]);     //nothing written
+                continue;
+            }
+            TEST_ASSERT_TRUE(used < len);
+            TEST_ASSERT_EQUAL(used, strlen(buf));
+            TEST_ASSERT_EQUAL('#', buf[len]);       //nothing past the buffer
+        }
+    }
+}
+
+//metrics message composition of the main loop with the report cut at any length
+void test_metrics_composition_is_bounded() {
+    char report[513];
+    for (size_t size = 1; size < sizeof(report); size++) {
+        memset(report, '#', sizeof(report));
+        size_t len = profileReport(report, size);
+        len = appendText(report, size, len, "\n");
+        len += renderReport(report + len, size - len);
+        len = appendText(report, size, len, "\n");
+        len += powerReport(report + len, size - len);
+        TEST_ASSERT_TRUE(len < size);
+        TEST_ASSERT_EQUAL('#', report[size]);
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_clamp_length);
+    RUN_TEST(test_append_text);
+    RUN_TEST(test_reports_fit_any_buffer);
+    RUN_TEST(test_metrics_composition_is_bounded);
+    return UNITY_END();
+}
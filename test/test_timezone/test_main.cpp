@@ -0,0 +1,94 @@
+#include <unity.h>
+#include "timezone.h"
+
+void setUp() {}
+void tearDown() {}
+
+//offset just before and at the transition
+static void assertTransition(Timezone &tz, unsigned long utc, long before, long after) {
+    TEST_ASSERT_EQUAL(before, tz.offset(utc - 1));
+    TEST_ASSERT_EQUAL(after, tz.offset(utc));
+}
+
+void test_civil_days() {
+    TEST_ASSERT_EQUAL(0, daysFromCivil(1970, 1, 1));
+    TEST_ASSERT_EQUAL(19723, daysFromCivil(2024, 1, 1));
+    TEST_ASSERT_EQUAL(19782, daysFromCivil(2024, 2, 29));
+    TEST_ASSERT_EQUAL(-1, daysFromCivil(1969, 12, 31));
+
+    for (long days = -1000; days < 80000; days += 13) {
+        int year;
+        unsigned month, day;
+        civilFromDays(days, year, month, day);
+        TEST_ASSERT_EQUAL(days, daysFromCivil(year, month, day));
+    }
+}
+
+void test_central_europe() {
+    Timezone tz;
+    TEST_ASSERT_TRUE(tz.set("CET-1CEST,M3.5.0,M10.5.0/3"));
+    assertTransition(tz, 1711846800, 3600, 7200);   //31.3.2024 02:00 CET
+    assertTransition(tz, 1729990800, 7200, 3600);   //27.10.2024 03:00 CEST
+    TEST_ASSERT_TRUE(tz.dst(1720000000));
+    TEST_ASSERT_FALSE(tz.dst(1735000000));
+}
+
+void test_north_america() {
+    Timezone tz;
+    TEST_ASSERT_TRUE(tz.set("EST5EDT,M3.2.0,M11.1.0"));
+    assertTransition(tz, 1710054000, -18000, -14400);   //10.3.2024 02:00 EST
+    assertTransition(tz, 1730613600, -14400, -18000);   //3.11.2024 02:00 EDT
+}
+
+void test_southern_hemisphere() {
+    Timezone tz;
+    TEST_ASSERT_TRUE(tz.set("AEST-10AEDT,M10.1.0,M4.1.0/3"));
+    assertTransition(tz, 1712419200, 39600, 36000);     //7.4.2024 03:00 AEDT
+    assertTransition(tz, 1728144000, 36000, 39600);     //6.10.2024 02:00 AEST
+    TEST_ASSERT_TRUE(tz.dst(1704067200));               //January is summer
+}
+
+void test_fixed_offsets() {
+    Timezone tz;
+    TEST_ASSERT_TRUE(tz.set("<+0530>-5:30"));
+    TEST_ASSERT_EQUAL(19800, tz.offset(1711846800));
+    TEST_ASSERT_FALSE(tz.dst(1720000000));
+    TEST_ASSERT_TRUE(tz.set("UTC0"));
+    TEST_ASSERT_EQUAL(0, tz.offset(1711846800));
+    tz.setOffset(-7200);
+    TEST_ASSERT_EQUAL(-7200, tz.offset(1711846800));
+}
+
+void test_invalid_rules_keep_previous() {
+    static const char *const invalid[] = {
+        "", "C-1", "CET", "CET-1CEST", "CET-1CEST,M3.5.0", "CET-1CEST,M13.5.0,M10.5.0", "CET-1CEST,M3.6.0,M10.5.0",
+        "CET-1CEST,M3.5.7,M10.5.0", "CET-1CEST,J60,J300", "CET-1CEST,M3.5.0,M10.5.0x", "<+03-3", NULL
+    };
+    Timezone tz;
+    TEST_ASSERT_TRUE(tz.set("CET-1CEST,M3.5.0,M10.5.0/3"));
+    for (const char *const *rule = invalid; *rule; rule++) {
+        TEST_ASSERT_FALSE_MESSAGE(tz.set(*rule), *rule);
+    }
+    TEST_ASSERT_EQUAL(7200, tz.offset(1720000000));
+}
+
+void test_cache_in_both_directions() {
+    Timezone tz;
+    TEST_ASSERT_TRUE(tz.set("CET-1CEST,M3.5.0,M10.5.0/3"));
+    TEST_ASSERT_EQUAL(3600, tz.offset(2085976800));     //2036, after the NTP era rollover
+    TEST_ASSERT_EQUAL(7200, tz.offset(1720000000));     //back in time
+    TEST_ASSERT_EQUAL(3600, tz.offset(1735000000));
+    TEST_ASSERT_EQUAL(7200, tz.offset(1720000000));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_civil_days);
+    RUN_TEST(test_central_europe);
+    RUN_TEST(test_north_america);
+    RUN_TEST(test_southern_hemisphere);
+    RUN_TEST(test_fixed_offsets);
+    RUN_TEST(test_invalid_rules_keep_previous);
+    RUN_TEST(test_cache_in_both_directions);
+    return UNITY_END();
+}
@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""Cut u8g2 fonts down to the glyphs the firmware draws (icon fonts) and report font sizes.
+
+Fonts are taken from u8g2_fonts.c of the installed U8g2 library and written as a header of
+PROGMEM arrays, main.cpp includes it when present and uses the full fonts otherwise.
+Runs as PlatformIO extra script before main.cpp is compiled (header in $BUILD_DIR/font_subset)
+or by hand:
+
+Usage: python3 tools/font_subset.py <u8g2_fonts.c> [<output.h>]
+       python3 tools/font_subset.py --self-test
+"""
+import glob
+import os
+import re
+import sys
+
+#keep in sync with src/main.cpp: full font, subset name, drawn glyphs (encodings below 256 only)
+SUBSETS = [
+    ("u8g2_font_open_iconic_weather_1x_t", "font_weather_icons", "\x42\x45"),     #moon, sun
+    ("u8g2_font_open_iconic_www_1x_t", "font_www_icons", "\x47"),                 #gps pin
+]
+#numeric variants used instead of the full fonts, reported with the full font's size
+REPORT = [
+    ("u8g2_font_profont15_tn", "u8g2_font_profont15_tf"),
+    ("u8g2_font_profont22_tn", "u8g2_font_profont22_tf"),
+]
+
+HEADER = 23             #u8g2 font header (glyph count, bit field sizes, metrics, start positions)
+POS_UPPER_A = 17        #big endian offsets from the end of the header
+POS_LOWER_A = 19
+POS_UNICODE = 21
+ESCAPES = {"n": 10, "t": 9, "r": 13, "a": 7, "b": 8, "f": 12, "v": 11, "\\": 92, '"': 34, "'": 39, "?": 63}
+
+
+def decodeLiteral(text):
+    """bytes of C string literal contents"""
+    data = bytearray()
+    i = 0
+    while i < len(text):
+        if text[i] != "\\":
+            data += text[i].encode("latin-1")
+            i += 1
+        elif text[i + 1] in "01234567":
+            digits = re.match(r"[0-7]{1,3}", text[i + 1:]).group(0)
+            data.append(int(digits, 8))
+            i += 1 + len(digits)
+        elif text[i + 1] == "x":
+            digits = re.match(r"[0-9a-fA-F]+", text[i + 2:]).group(0)
+            data.append(int(digits, 16) & 0xFF)
+            i += 2 + len(digits)
+        else:
+            data.append(ESCAPES[text[i + 1]])
+            i += 2
+    return bytes(data)
+
+
+def loadFont(source, name):
+    """font data (without the terminating zero of the literal) or None"""
+    match = re.search(r"\b%s\[\d+\][^=;]*=\s*((?:\"(?:[^\"\\]|\\.)*\"\s*)+);" % name, source)
+    if not match:
+        return None
+    return decodeLiteral("".join(re.findall(r"\"((?:[^\"\\]|\\.)*)\"", match.group(1))))
+
+
+def word(data, pos):
+    return data[pos] << 8 | data[pos + 1]
+
+
+def asciiGlyphs(font):
+    """glyphs below 256 as (encoding, bytes) and position of the terminator"""
+    glyphs = []
+    pos = HEADER
+    while font[pos + 1]:
+        glyphs.append((font[pos], font[pos:pos + font[pos + 1]]))
+        pos += font[pos + 1]
+    return glyphs, pos
+
+
+def glyphData(font, encoding):
+    """glyph lookup of u8g2_font_get_glyph_data() for encodings below 256"""
+    pos = HEADER
+    if encoding >= ord("a"):
+        pos += word(font, POS_LOWER_A)
+    elif encoding >= ord("A"):
+        pos += word(font, POS_UPPER_A)
+    while font[pos + 1]:
+        if font[pos] == encoding:
+            return font[pos:pos + font[pos + 1]]
+        pos += font[pos + 1]
+    return None
+
+
+def subset(font, chars):
+    """font with only the glyphs of chars, the unicode part is kept as it is"""
+    wanted = set(ord(c) for c in chars)
+    glyphs, end = asciiGlyphs(font)
+    missing = wanted - set(encoding for encoding, _ in glyphs)
+    if missing:
+        raise ValueError("glyphs %s not in font" % ", ".join("0x%02x" % e for e in sorted(missing)))
+
+    kept = [(encoding, data) for encoding, data in glyphs if encoding in wanted]
+    body = b"".join(data for _, data in kept)
+    delta = len(body) - (end - HEADER)
+
+    def start(first):
+        offset = 0
+        for encoding, data in kept:
+            if encoding >= first:
+                break
+            offset += len(data)
+        return offset
+
+    header = bytearray(font[:HEADER])
+    header[0] = font[0] - (len(glyphs) - len(kept))
+    header[POS_UPPER_A:POS_UPPER_A + 2] = start(ord("A")).to_bytes(2, "big")
+    header[POS_LOWER_A:POS_LOWER_A + 2] = start(ord("a")).to_bytes(2, "big")
+    unicode = word(font, POS_UNICODE)
+    if HEADER + unicode >= end:
+        header[POS_UNICODE:POS_UNICODE + 2] = (unicode + delta).to_bytes(2, "big")
+    result = bytes(header) + body + font[end:]
+
+    for encoding in range(256):     #every glyph is found as before or not at all
+        expected = glyphData(font, encoding) if encoding in wanted else None
+        if glyphData(result, encoding) != expected:
+            raise ValueError("glyph 0x%02x differs in subset" % encoding)
+    return result
+
+
+def cArray(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "static const uint8_t %s[%d] PROGMEM = {\n%s\n};\n" % (name, len(data) + 1, "\n".join(lines + ["    0x00"]))
+
+
+def generate(fonts_c, output):
+    """write header with the subsets, returns report lines"""
+    with open(fonts_c, encoding="latin-1") as f:
+        source = f.read()
+    report = []
+    arrays = []
+    for font_name, subset_name, chars in SUBSETS:
+        font = loadFont(source, font_name)
+        if font is None:
+            raise ValueError("%s not found in %s" % (font_name, fonts_c))
+        data = subset(font, chars)
+        report.append("%s: %d of %d glyphs, %d -> %d bytes" % (font_name, len(chars), len(asciiGlyphs(font)[0]),
+                                                                 len(font) + 1, len(data) + 1))
+        arrays.append("//%s cut to %d glyphs\n%s" % (font_name, len(chars), cArray(subset_name, data)))
+    for used, full in REPORT:
+        sizes = [loadFont(source, name) for name in (used, full)]
+        if None not in sizes:
+            report.append("%s: %d bytes (%s %d bytes)" % (used, len(sizes[0]) + 1, full, len(sizes[1]) + 1))
+
+    with open(output, "w") as f:
+        f.write("#pragma once\n\n//Generated by tools/font_subset.py from U8g2 %s, do not edit\n\n" % os.path.basename(fonts_c))
+        f.write("\n".join(arrays))
+    return report
+
+
+def selfTest():
+    """subset of a synthetic font with glyphs around 'A' and 'a' and a unicode part"""
+    glyphs = [bytes([e, 5, e, e ^ 0xFF, 1]) for e in (0x20, 0x30, 0x41, 0x42, 0x5A, 0x61, 0x7A)]
+    ascii_part = b"".join(glyphs) + b"\x00\x00"
+    unicode_part = b"\x00\x04\xff\xff" + b"\x01\x00\x05\x11\x22" + b"\x00\x00"
+    header = bytearray(HEADER)
+    header[0] = len(glyphs) + 1
+    header[POS_UPPER_A:POS_UPPER_A + 2] = (2 * 5).to_bytes(2, "big")
+    header[POS_LOWER_A:POS_LOWER_A + 2] = (5 * 5).to_bytes(2, "big")
+    header[POS_UNICODE:POS_UNICODE + 2] = len(ascii_part).to_bytes(2, "big")
+    font = bytes(header) + ascii_part + unicode_part
+
+    for chars in ["", " ", "B", "a", "0Bz", " 0ABZaz"]:
+        data = subset(font, chars)
+        assert data[0] == len(chars) + 1
+        assert len(data) == len(font) - 5 * (len(glyphs) - len(chars))
+        assert data.endswith(unicode_part)
+        assert word(data, POS_UNICODE) == len(data) - HEADER - len(unicode_part)
+    assert decodeLiteral(r"\6\0A\42\\\"\?\x7f") == b"\x06\x00A\x22\\\"?\x7f"
+    assert loadFont('const uint8_t f[4] X("f") =\n  "\\1"\n  "a\\0";', "f") == b"\x01a\x00"
+    try:
+        subset(font, "C")
+        raise AssertionError("missing glyph accepted")
+    except ValueError:
+        pass
+    print("font_subset self-test passed")
+
+
+def findFonts(libdeps):
+    found = glob.glob(os.path.join(libdeps, "U8g2*", "src", "clib", "u8g2_fonts.c"))
+    return found[0] if found else None
+
+
+def platformioAction(target, source, env):
+    output = os.path.join(env.subst("$BUILD_DIR"), "font_subset", "font_subset.h")
+    os.makedirs(os.path.dirname(output), exist_ok=True)
+    fonts_c = findFonts(os.path.join(env.subst("$PROJECT_LIBDEPS_DIR"), env.subst("$PIOENV")))
+    if fonts_c is None:     #full fonts are used
+        if os.path.exists(output):
+            os.remove(output)
+        print("font_subset: U8g2 fonts not found, using full fonts")
+        return
+    for line in generate(fonts_c, output):
+        print("font_subset: " + line)
+
+
+def main(args):
+    if args == ["--self-test"]:
+        selfTest()
+        return 0
+    if not 1 <= len(args) <= 2:
+        print(__doc__.strip())
+        return 1
+    report = generate(args[0], args[1] if len(args) > 1 else os.devnull)
+    print("\n".join(report))
+    return 0
+
+
+try:
+    Import("env")   # noqa: F821 (PlatformIO extra script)
+    env.Append(CPPPATH=[os.path.join(env.subst("$BUILD_DIR"), "font_subset")])      # noqa: F821
+    env.AddPreAction("$BUILD_DIR/src/main.cpp.o", platformioAction)                 # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Generate animation frames of weather icons as XOR deltas (src/animations.h).
+
+Frames are computed from the bitmaps in src/weather_icons.h, every frame is stored
+as list of changed bytes (row, byte column, xor bits) against the bitmap itself.
+
+Usage: python3 tools/make_animations.py > src/animations.h
+"""
+import re
+import sys
+
+ICONS = "src/weather_icons.h"
+WIDTH = 64
+HEIGHT = 42
+ROW_BYTES = (WIDTH + 7) // 8
+
+
+def load(source, name):
+    match = re.search(r"%s\[\]\s*=\s*\{([^}]*)\}" % name, source)
+    data = [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", match.group(1))]
+    return [[(data[r * ROW_BYTES + c // 8] >> (c % 8)) & 1 for c in range(WIDTH)] for r in range(HEIGHT)]
+
+
+def pack(pixels):
+    return [sum(pixels[r][c * 8 + b] << b for b in range(8)) for r in range(HEIGHT) for c in range(ROW_BYTES)]
+
+
+def precipitation(pixels):
+    """rows below the cloud (after first empty row under the drawing)"""
+    seen = False
+    for r, row in enumerate(pixels):
+        if any(row):
+            seen = True
+        elif seen:
+            return r + 1
+    return HEIGHT
+
+
+def fall(count):
+    """drops falling through precipitation rows in count frames (wrapping, so the cycle is seamless)"""
+    def frames(pixels):
+        top = precipitation(pixels)
+        height = max(HEIGHT - top, 1)
+        result = []
+        for k in range(count):
+            shift = k * height // count
+            frame = [row[:] for row in pixels]
+            for r in range(top, HEIGHT):
+                frame[r] = pixels[top + (r - top - shift) % height][:]
+            result.append(frame)
+        return result
+    return frames
+
+
+def drift(offsets, band=0):
+    """whole bitmap shifted horizontally, every other band of rows moves the other way"""
+    def frames(pixels):
+        result = []
+        for offset in offsets:
+            frame = []
+            for r, row in enumerate(pixels):
+                o = -offset if band and (r // band) % 2 else offset
+                frame.append([row[c - o] if 0 <= c - o < WIDTH else 0 for c in range(WIDTH)])
+            result.append(frame)
+        return result
+    return frames
+
+
+def storm(cloud):
+    """lightning: bolt below the cloud goes dark, then the cloud flashes (inverted)"""
+    def frames(pixels):
+        dark = [row[:] if r < cloud else [0] * WIDTH for r, row in enumerate(pixels)]
+        flash = [row[:] for row in pixels]
+        for r in range(cloud):
+            columns = [c for c in range(WIDTH) if pixels[r][c]]
+            for c in range(min(columns), max(columns) + 1) if columns else []:
+                flash[r][c] ^= 1
+        return [pixels, dark, pixels, flash]
+    return frames
+
+
+#bitmap, frame generator
+ANIMATIONS = [
+    ("few_clouds_day", drift([0, 1, 2, 1])),
+    ("few_clouds1_night", drift([0, 1, 2, 1])),
+    ("scattered_clouds", drift([0, 1, 2, 1])),
+    ("broken_clouds", drift([0, 1, 2, 1])),
+    ("shower_rain", fall(5)),
+    ("rain_day", fall(5)),
+    ("rain_night", fall(5)),
+    ("thunderstorm", storm(31)),
+    ("snow1", fall(8)),
+    ("mist", drift([0, 1, 2, 1], band=5)),
+]
+
+
+def main():
+    source = open(ICONS).read()
+    out = ["//generated by tools/make_animations.py from weather_icons.h, do not edit",
+           "//frame deltas (row, byte column, xor bits) against the bitmap, frame 0 is the bitmap itself",
+           "#pragma once", "", "#include <Arduino.h>", '#include "animation.h"', ""]
+    total = 0
+    for name, generator in ANIMATIONS:
+        base = load(source, name + "_bits")
+        base_bytes = pack(base)
+        starts = [0]
+        deltas = []
+        for frame in generator(base):
+            for i, (a, b) in enumerate(zip(base_bytes, pack(frame))):
+                if a != b:
+                    deltas += [i // ROW_BYTES, i % ROW_BYTES, a ^ b]
+            starts.append(len(deltas) // 3)
+        size = len(deltas) + 2 * len(starts) + 12
+        total += size
+        out.append("//%s: %d frames, %d deltas, %d bytes of flash" % (name, len(starts) - 1, len(deltas) // 3, size))
+        out.append("static const uint8_t %s_deltas[] PROGMEM = {" % name)
+        for i in range(0, len(deltas), 24):
+            out.append("    " + ", ".join("0x%02x" % d for d in deltas[i:i + 24]) + ",")
+        out.append("};")
+        out.append("static const uint16_t %s_starts[] PROGMEM = {%s};" % (name, ", ".join(str(s) for s in starts)))
+        out.append("static const Animation %s_animation = {%d, %s_starts, %s_deltas};" % (name, len(starts) - 1, name, name))
+        out.append("")
+    out.append("//total %d bytes of flash" % total)
+    print("\n".join(out))
+    print("total %d bytes of flash" % total, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
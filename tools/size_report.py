@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Compare firmware section sizes of two revisions.
+
+Usage: python3 tools/size_report.py <before> [<after>] [-e <env>]
+
+Each revision is built by PlatformIO in a temporary git worktree (after defaults to
+the working tree, env to d1_mini_lite). Flash code is .irom0.text, IRAM code .text,
+constant data .rodata, RAM .data and .bss.
+"""
+import glob
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+SECTIONS = [".irom0.text", ".text", ".rodata", ".data", ".bss"]
+
+
+def sizeTool():
+    tools = glob.glob(os.path.expanduser("~/.platformio/packages/toolchain-xtensa*/bin/xtensa-lx106-elf-size"))
+    if not tools:
+        raise RuntimeError("xtensa toolchain not found, build any environment with pio first")
+    return tools[0]
+
+
+def build(path, env):
+    subprocess.run(["pio", "run", "-d", path, "-e", env], check=True, stdout=subprocess.DEVNULL)
+    return os.path.join(path, ".pio", "build", env, "firmware.elf")
+
+
+def sections(elf):
+    output = subprocess.run([sizeTool(), "-A", elf], check=True, capture_output=True, text=True).stdout
+    sizes = {}
+    for line in output.splitlines():
+        match = re.match(r"(\S+)\s+(\d+)\s+\d+", line)
+        if match and match.group(1) in SECTIONS:
+            sizes[match.group(1)] = int(match.group(2))
+    return sizes
+
+
+def revisionSizes(revision, env):
+    if revision is None:
+        return sections(build(".", env))
+    with tempfile.TemporaryDirectory() as path:
+        subprocess.run(["git", "worktree", "add", "--detach", path, revision], check=True, stdout=subprocess.DEVNULL)
+        try:
+            return sections(build(path, env))
+        finally:
+            subprocess.run(["git", "worktree", "remove", "--force", path], check=True)
+
+
+def main(args):
+    env = "d1_mini_lite"
+    if "-e" in args:
+        index = args.index("-e")
+        env = args[index + 1]
+        del args[index:index + 2]
+    if not 1 <= len(args) <= 2:
+        print(__doc__.strip())
+        return 1
+
+    before = revisionSizes(args[0], env)
+    after = revisionSizes(args[1] if len(args) > 1 else None, env)
+    print("%-12s %8s %8s %8s" % ("section", "before", "after", "change"))
+    for name in SECTIONS:
+        print("%-12s %8d %8d %+8d" % (name, before.get(name, 0), after.get(name, 0), after.get(name, 0) - before.get(name, 0)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Decode event trace published by the station on devices/<device_name>/trace.
+
+Usage: mosquitto_sub -t 'devices/<device_name>/trace' -C 1 > trace.bin
+       python3 tools/trace_decode.py trace.bin
+"""
+import struct
+import sys
+
+MAGIC = 0x54524345
+WORDS = 96
+
+#keep in sync with src/trace.h
+EVENTS = [
+    None, "boot", "wifi connecting", "wifi connected", "wifi lost", "wifi restart",
+    "mqtt connected", "mqtt failed", "mqtt message", "ntp sync", "ntp failed",
+    "parse start", "parse done", "parse failed", "draw", "send", "config",
+    "ota start", "ota end", "ota error", "wifi fallback",
+]
+RESET_REASONS = ["power on", "hardware watchdog", "exception", "software watchdog",
+                 "software restart", "deep sleep wake", "external reset"]
+
+
+def decode(data):
+    if len(data) < WORDS * 4:
+        raise ValueError("trace too short (%d bytes)" % len(data))
+    words = struct.unpack("<%dI" % WORDS, data[:WORDS * 4])
+    if words[0] != MAGIC:
+        raise ValueError("bad magic %08x" % words[0])
+
+    head = words[1]
+    index = head & 0xFF
+    wrapped = bool(head & 0x100)
+    boot = head >> 16
+    entries = words[2:]
+    order = list(range(index, len(entries))) + list(range(index)) if wrapped else list(range(index))
+
+    print("boot %d, %d events" % (boot, len(order)))
+    offset = 0
+    last = None
+    for i in order:
+        code, arg, time = entries[i] >> 24, (entries[i] >> 16) & 0xFF, entries[i] & 0xFFFF
+        if last is not None and time + offset < last:
+            offset += 0x10000   #64ms counter wrapped
+        last = time + offset
+        name = EVENTS[code] if code < len(EVENTS) and EVENTS[code] else "unknown %d" % code
+        if code == 1 and arg < len(RESET_REASONS):
+            name += " (%s)" % RESET_REASONS[arg]
+        elif arg:
+            name += " %d" % arg
+        print("%10.3f s  %s" % (last * 64 / 1000.0, name))
+
+
+if __name__ == "__main__":
+    with open(sys.argv[1], "rb") if len(sys.argv) > 1 else sys.stdin.buffer as f:
+        decode(f.read())